@@ -1064,6 +1064,29 @@ void RenderInterface_GL3::ReleaseGeometry(Rml::CompiledGeometryHandle handle)
 	delete geometry;
 }
 
+bool RenderInterface_GL3::UpdateGeometry(Rml::CompiledGeometryHandle handle, Rml::Span<const Rml::Vertex> vertices, Rml::Span<const int> indices)
+{
+	Gfx::CompiledGeometryData* geometry = (Gfx::CompiledGeometryData*)handle;
+
+	// Merged geometry is updated frequently, reuse its buffers and vertex array state instead of creating new ones.
+	constexpr GLenum draw_usage = GL_DYNAMIC_DRAW;
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, geometry->vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Rml::Vertex) * vertices.size(), (const void*)vertices.data(), draw_usage);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry->ibo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int) * indices.size(), (const void*)indices.data(), draw_usage);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	geometry->draw_count = (GLsizei)indices.size();
+
+	Gfx::CheckGLError("UpdateGeometry");
+
+	return true;
+}
+
 /// Flip the vertical axis of the rectangle, and move its origin to the vertically opposite side of the viewport.
 /// @note Changes the coordinate system from RmlUi to OpenGL, or equivalently in reverse.
 /// @note The Rectangle::Top and Rectangle::Bottom members will have reverse meaning in the returned rectangle.
@@ -1466,6 +1489,18 @@ void RenderInterface_GL3::ReleaseTexture(Rml::TextureHandle texture_handle)
 	glDeleteTextures(1, (GLuint*)&texture_handle);
 }
 
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source_data, Rml::Rectanglei region)
+{
+	RMLUI_ASSERT(source_data.data() && source_data.size() == size_t(region.Width() * region.Height() * 4));
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, region.Left(), region.Top(), region.Width(), region.Height(), GL_RGBA, GL_UNSIGNED_BYTE,
+		source_data.data());
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return true;
+}
+
 void RenderInterface_GL3::SetTransform(const Rml::Matrix4f* new_transform)
 {
 	transform = (new_transform ? (projection * (*new_transform)) : projection);
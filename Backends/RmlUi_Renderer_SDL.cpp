@@ -59,6 +59,12 @@ void RenderInterface_SDL::ReleaseGeometry(Rml::CompiledGeometryHandle geometry)
 	delete reinterpret_cast<GeometryView*>(geometry);
 }
 
+bool RenderInterface_SDL::UpdateGeometry(Rml::CompiledGeometryHandle geometry, Rml::Span<const Rml::Vertex> vertices, Rml::Span<const int> indices)
+{
+	*reinterpret_cast<GeometryView*>(geometry) = GeometryView{vertices, indices};
+	return true;
+}
+
 void RenderInterface_SDL::RenderGeometry(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, Rml::TextureHandle texture)
 {
 	const GeometryView* geometry = reinterpret_cast<GeometryView*>(handle);
@@ -52,6 +52,7 @@
 #include "Core/PropertySpecification.h"
 #include "Core/RenderInterface.h"
 #include "Core/RenderManager.h"
+#include "Core/RenderStatistics.h"
 #include "Core/Spritesheet.h"
 #include "Core/StringUtilities.h"
 #include "Core/StyleSheet.h"
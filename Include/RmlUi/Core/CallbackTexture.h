@@ -29,6 +29,16 @@ public:
 
 	operator Texture() const;
 
+	/// Replaces a region of the texture, if it has already been generated.
+	/// @param[in] source Texture data of the region in 8-bit RGBA (premultiplied) format, with rows tightly packed.
+	/// @param[in] region The region of the texture to update.
+	/// @note The callback function should produce the updated contents from now on, since the texture may be generated again later.
+	void UpdateRegion(Span<const byte> source, Rectanglei region);
+
+	/// Returns true if the texture is currently generated, false if it is yet to be generated or has since been released.
+	/// @note Does not invoke the callback function.
+	bool IsGenerated() const;
+
 	void Release();
 
 private:
@@ -53,7 +63,8 @@ public:
 
 	/// Store the current layer as a texture, so that it can be rendered with geometry later.
 	/// @note The texture will be extracted using the bounds defined by the active scissor region, thereby matching its size.
-	void SaveLayerAsTexture() const;
+	/// @return True on success.
+	bool SaveLayerAsTexture() const;
 
 	/// Manually set the texture directly from a custom texture handle.
 	/// @param[in] handle The handle that represents the texture.
@@ -88,6 +99,10 @@ public:
 
 	Texture GetTexture(RenderManager& render_manager) const;
 
+	/// Replaces a region of the texture for each render manager where it has been generated.
+	/// @see CallbackTexture::UpdateRegion
+	void UpdateRegion(Span<const byte> source, Rectanglei region) const;
+
 private:
 	CallbackTextureFunction callback;
 	mutable SmallUnorderedMap<RenderManager*, CallbackTexture> textures;
@@ -2,6 +2,7 @@
 
 #include "Header.h"
 #include "Input.h"
+#include "RenderStatistics.h"
 #include "ScriptInterface.h"
 #include "ScrollTypes.h"
 #include "Traits.h"
@@ -293,6 +294,25 @@ public:
 	/// @return Time until the next update is expected.
 	double GetNextUpdateDelay() const;
 
+	/// Marks the whole context as changed, so that the next call to IsRenderRequired() returns true. Changes made through elements are tracked
+	/// automatically, this is only needed for changes the context cannot observe, such as a texture modified by the application.
+	void RequestNextRender();
+	/// Returns true if anything visible may have changed since the previous call to Render(). This should be queried after calling Update(). If
+	/// false, the application can skip Render() and present the previously rendered frame instead.
+	/// @return True if the context needs to be rendered again.
+	bool IsRenderRequired() const;
+	/// Returns the areas of the context that may have changed since the previous call to Render(). This should be queried after calling
+	/// Update(), and is cleared by Render(). An application caching the rendered context, such as in a texture layer, only needs to update the
+	/// pixels within these rectangles.
+	/// @return A list of non-overlapping rectangles in window coordinates, empty if nothing changed.
+	const Vector<Rectanglei>& GetDamageRegion() const;
+
+	/// Returns the statistics of the most recently rendered frame. This includes all work submitted to the render interface from the end of the
+	/// previous call to Render() until the end of the latest one. Thus, work submitted by any other context sharing the same render interface
+	/// during this time is also included.
+	/// @return The counters of the previous frame.
+	const RenderStatistics& GetRenderStatistics() const;
+
 protected:
 	void Release() override;
 
@@ -390,8 +410,34 @@ private:
 	// See RequestNextUpdate() and NextUpdateRequested() for details.
 	double next_update_timeout = 0;
 
+	// True if the whole context needs to be rendered again. See RequestNextRender() and IsRenderRequired().
+	bool render_required = true;
+
+	// Elements which changed their appearance since the previous update, their areas are added to the damage region during the next update.
+	Vector<ObserverPtr<Element>> damaged_elements;
+	// The areas of the context changed since the previous render. See GetDamageRegion().
+	Vector<Rectanglei> damage_region;
+
+	// Counters of the most recently rendered frame. See GetRenderStatistics().
+	RenderStatistics frame_statistics;
+	// The render manager counters at the end of the previous frame, used to determine the work done during the current frame.
+	RenderStatistics previous_render_statistics;
+	int num_elements_updated = 0;
+	int num_elements_rendered = 0;
+
+	// Adds the changed areas of all damaged elements to the damage region.
+	void UpdateDamageRegion();
+	// Returns the area covered by the element when rendered, including the spread of filters on its ancestors.
+	Rectanglef GetDamageBounds(Element* element);
+	// Resolves the transform of the element and its ancestors, which is otherwise only done during rendering.
+	static void UpdateTransformStates(Element* element);
+	// Adds the given area to the damage region, merging it with any overlapping rectangles.
+	void AddDamage(Rectanglef area);
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
+	// Internal callback for when an element changed its appearance and needs to be rendered again.
+	void OnElementRenderDirty(Element* element);
 	// Internal callback for when a new element gains focus.
 	bool OnFocusChange(Element* element, bool focus_visible);
 
@@ -427,6 +473,9 @@ private:
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
+	// Computes the styles of separate documents and subtrees on the worker threads of the system interface, ahead of the update.
+	void PrecomputeStyles();
+
 	// Helper method to lookup TouchState by touch id.
 	TouchState* LookupTouch(TouchId identifier);
 	// Process a single touch movement for this context.
@@ -17,6 +17,12 @@ public:
 
 	bool IsVariableDirty(const String& variable_name);
 	void DirtyVariable(const String& variable_name);
+	// Dirty a single entry of an array variable. Only views bound to the entry or its members are updated, along with views bound to the
+	// whole array or its size.
+	void DirtyVariable(const String& variable_name, int index);
+	// Dirty the variable at the given address, eg. a member of an array entry. Only views bound to the address, its parents, or its children
+	// are updated.
+	void DirtyAddress(const DataAddress& address);
 	void DirtyAllVariables();
 
 	explicit operator bool() { return model; }
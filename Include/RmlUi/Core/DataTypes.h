@@ -33,6 +33,7 @@ template <typename Object, typename AssignType>
 using MemberSetterFunc = void (Object::*)(AssignType);
 
 using DirtyVariables = SmallUnorderedSet<String>;
+using DirtyAddresses = UnorderedSet<String>;
 
 struct DataAddressEntry {
 	DataAddressEntry(String name) : name(std::move(name)), index(-1) {}
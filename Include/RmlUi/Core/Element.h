@@ -18,6 +18,7 @@ namespace Rml {
 
 class Context;
 class DataModel;
+class DataViewFor;
 class Decorator;
 class ElementInstancer;
 class EventDispatcher;
@@ -27,6 +28,8 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class FormattingContext;
+class HitTestGrid;
 class LayoutEngine;
 class ContainerBox;
 class InlineLevelBox;
@@ -151,6 +154,7 @@ public:
 	bool IsReplaced();
 
 	/// Checks if a given point in screen coordinates lies within the bordered area of this element.
+	/// @note Hit testing may skip elements whose border boxes do not contain the point, overrides should not extend beyond this area.
 	/// @param[in] point The point to test.
 	/// @return True if the element is within this element, false otherwise.
 	virtual bool IsPointWithinElement(Vector2f point);
@@ -590,6 +594,13 @@ public:
 	/// Return the computed values of the element's properties. These values are updated as appropriate on every Context::Update.
 	const ComputedValues& GetComputedValues() const;
 
+	/// Marks this element to be visited during the next update loop, even if it has no other pending changes. This calls OnUpdate() on the
+	/// element, which may call this function again to keep receiving updates.
+	void DirtyUpdate();
+	/// Notifies the owning context that the element needs to be rendered again. Custom elements should call this whenever they change their
+	/// visual appearance without changing any properties, attributes, or boxes, such as when animating their content during OnUpdate().
+	void DirtyRender();
+
 protected:
 	void Update(float dp_ratio, Vector2f vp_dimensions);
 	void Render();
@@ -599,8 +610,13 @@ protected:
 
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
+	/// Enables calls to OnUpdate() on every update loop, for elements which need to do work even when nothing has changed.
+	/// @param[in] enable True to call OnUpdate() on every update, false to only call it when the element has pending changes.
+	void EnableOnUpdate(bool enable);
 
 	/// Called during the update loop after children are updated.
+	/// @note Unless enabled with EnableOnUpdate(), this is only called during updates where the element or any of its descendants have pending
+	/// changes, such as dirty properties or running animations, or when requested with DirtyUpdate().
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -657,12 +673,25 @@ protected:
 	void Release() override;
 
 private:
+	// Implementations of Update() and Render(), where the context is passed down instead of being looked up by each element.
+	void Update(float dp_ratio, Vector2f vp_dimensions, Context* context);
+	void Render(Context* context);
+
 	void SetParent(Element* parent);
 
 	void SetDataModel(DataModel* new_data_model);
 
+	/// Reorders a range of DOM children without detaching them from the document or their data model.
+	/// @param[in] child_index The index of the first child in the range.
+	/// @param[in] new_order The children of the range in their new order, the range must consist of exactly these children.
+	void ReorderChildren(int child_index, const ElementList& new_order);
+
 	void DirtyAbsoluteOffset();
 	void DirtyAbsoluteOffsetRecursive();
+	/// Called when the scroll offset changes. Elements positioned by it are not dirtied, instead they validate their absolute offset when needed.
+	void DirtyScrollOffset();
+	/// Returns true if any descendants moved by our scrolling may render outside our clipping region.
+	bool HasUnclippedScrollContent();
 	void UpdateAbsoluteOffsetAndRenderBoxData();
 	void UpdateOffset();
 	void SetBaseline(float baseline);
@@ -672,14 +701,24 @@ private:
 	void AddToStackingContext(Vector<StackingContextChild>& stacking_children, bool is_flex_item, bool is_non_dom_element);
 	void DirtyStackingContext();
 	Element* ClosestStackingContextContainer();
+	/// Retrieves the area covered by this element and its local stacking context when rendered, in window coordinates.
+	/// @return False if the area is not known, such as when the element changed since the last update or is transformed.
+	bool GetRenderBounds(Rectanglef& out_bounds) const;
+
+	bool UpdateDefinition(bool allow_transitions = true);
 
-	void UpdateDefinition();
+	/// Updates the definition and computed values of this element ahead of the update, possibly concurrently with other subtrees.
+	/// @return False if the element is left for the update, which then also applies to its descendants.
+	bool PrecomputeStyle(float dp_ratio, Vector2f vp_dimensions);
+	/// Calls PrecomputeStyle() on all descendants which need to be updated, parents before their children.
+	void PrecomputeDescendantStyles(float dp_ratio, Vector2f vp_dimensions);
 
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
 
 	void OnDpRatioChangeRecursive();
 	void DirtyFontFaceRecursive();
+	void DirtyRenderRecursive();
 
 	void ClampScrollOffset();
 	void ClampScrollOffsetRecursive();
@@ -725,6 +764,12 @@ private:
 	bool dirty_transform : 1;
 	bool dirty_perspective : 1;
 
+	bool dirty_update : 1; // Set when this element or any of its descendants need to be visited during update.
+	bool on_update_enabled : 1;
+	bool damage_pending : 1; // Set when the element is waiting for its context to add it to the damage region.
+	bool stacking_context_bounds_dirty : 1; // Set when any element in the local stacking context may have changed its area.
+	bool unclipped_scroll_content : 1;      // Cached result of HasUnclippedScrollContent().
+
 	OwnedElementList children;
 	int num_non_dom_children;
 
@@ -763,6 +808,15 @@ private:
 	// The offset this element adds to its logical children due to scrolling content.
 	Vector2f scroll_offset;
 
+	// Changed whenever the offset this element provides to elements positioned relative to it changes, such as by scrolling.
+	int offset_version;
+	// The offset version of our offset parent when our absolute offset was last calculated.
+	int offset_parent_version;
+	// The scroll generation when our offset parent was last validated, see DirtyScrollOffset().
+	int validated_scroll_generation;
+	// The generation of our owner document when we last searched for unclipped scroll content, see HasUnclippedScrollContent().
+	int unclipped_scroll_content_generation;
+
 	// The size of the element.
 	struct PositionedBox {
 		Box box;
@@ -775,10 +829,15 @@ private:
 	// And of the element's scrollable content.
 	Vector2f scrollable_overflow_rectangle;
 
+	// The area covered by the element when it was last added to the damage region of its context.
+	Rectanglef damage_bounds;
+
 	float baseline;
 	float z_index;
 
 	ElementList stacking_context;
+	// The area covered by this element and its local stacking context when last rendered, or invalid if not known.
+	Rectanglef stacking_context_bounds;
 
 	UniquePtr<TransformState> transform_state;
 
@@ -787,7 +846,10 @@ private:
 	ElementMeta* meta;
 
 	friend class Rml::Context;
+	friend class Rml::DataViewFor;
 	friend class Rml::ElementStyle;
+	friend class Rml::FormattingContext;
+	friend class Rml::HitTestGrid;
 	friend class Rml::ContainerBox;
 	friend class Rml::InlineLevelBox;
 	friend class Rml::ReplacedBox;
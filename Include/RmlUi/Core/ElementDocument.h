@@ -8,6 +8,7 @@ class Context;
 class Stream;
 class DocumentHeader;
 class ElementText;
+class FormattingCache;
 class StyleSheet;
 class StyleSheetContainer;
 enum class NavigationSearchDirection;
@@ -144,6 +145,10 @@ private:
 	void DirtyLayout() override;
 	/// Returns true if the document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
+	/// Sets the dirty flag on the layout due to changes to a descendant, which is responsible for invalidating any affected formatting results.
+	void DirtyLayoutFromDescendant();
+	/// Marks a layout boundary inside the document as needing a re-layout of its contents, see LayoutEngine::IsLayoutBoundary.
+	void DirtyLayoutBoundary(Element* element);
 
 	/// Notify the document that media query-related properties have changed and that style sheets need to be re-evaluated.
 	void DirtyMediaQueries();
@@ -153,6 +158,8 @@ private:
 
 	/// Updates the layout if necessary.
 	void UpdateLayout();
+	/// Formats the contents of any dirty layout boundaries, returns false if the whole document needs to be formatted instead.
+	bool UpdateLayoutBoundaries();
 
 	/// Updates the position of the document based on the style properties.
 	void UpdatePosition();
@@ -172,8 +179,19 @@ private:
 	bool layout_dirty;
 	bool position_dirty;
 
+	// Incremented to invalidate the stored formatting results of all elements in the document, see FormattingCache.
+	int formatting_cache_generation = 0;
+
+	// Incremented when elements are attached, or change their clipping or fixed positioning, see Element::HasUnclippedScrollContent().
+	int unclipped_scroll_content_generation = 0;
+
+	// Layout boundaries whose contents should be formatted, only used when the layout of the whole document is clean.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
+
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
+	friend class Rml::FormattingCache;
 };
 
 } // namespace Rml
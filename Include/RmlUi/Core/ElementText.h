@@ -71,6 +71,8 @@ private:
 
 	// Clears and regenerates all of the text's geometry.
 	void GenerateGeometry(RenderManager& render_manager, FontFaceHandle font_face_handle);
+	// Applies the current colour and opacity to the existing geometry, only possible when it was generated from glyphs.
+	void UpdateGeometryColour();
 	// Generates any geometry necessary for rendering decoration (underline, strike-through, etc).
 	void GenerateDecoration(Mesh& mesh, FontFaceHandle font_face_handle);
 
@@ -83,6 +85,8 @@ private:
 		Texture texture;
 	};
 	Vector<TexturedGeometry> geometry;
+	// The glyphs the geometry was generated from, empty if the font engine does not support generating glyphs.
+	TexturedGlyphsList glyphs;
 
 	// The decoration geometry we've generated for this string.
 	UniquePtr<Geometry> decoration;
@@ -93,6 +97,7 @@ private:
 	int font_handle_version;
 
 	bool geometry_dirty : 1;
+	bool geometry_colour_dirty : 1;
 
 	bool dirty_layout_on_change : 1;
 
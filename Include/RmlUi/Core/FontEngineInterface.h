@@ -102,6 +102,19 @@ public:
 	virtual int GenerateString(RenderManager& render_manager, FontFaceHandle face_handle, FontEffectsHandle font_effects_handle, StringView string,
 		Vector2f position, ColourbPremultiplied colour, float opacity, const TextShapingContext& text_shaping_context, TexturedMeshList& mesh_list);
 
+	/// Called by RmlUi when it wants to retrieve the glyphs required to render a single line of text, used instead of GenerateString() when
+	/// supported. The glyphs are colourless, thereby the string need not be generated again when only the text colour or opacity changes.
+	/// @param[in] render_manager The render manager responsible for rendering the string.
+	/// @param[in] face_handle The font handle.
+	/// @param[in] font_effects_handle The handle to the prepared font effects for which the glyphs should be generated.
+	/// @param[in] string The string to render.
+	/// @param[in] position The position of the baseline of the first character to render.
+	/// @param[in] text_shaping_context Additional parameters that provide context for text shaping.
+	/// @param[out] glyphs_list A list to place the glyphs and textures representing the string to be rendered.
+	/// @return The width, in pixels, of the string, or a negative value if not supported by the font engine.
+	virtual int GenerateStringGlyphs(RenderManager& render_manager, FontFaceHandle face_handle, FontEffectsHandle font_effects_handle,
+		StringView string, Vector2f position, const TextShapingContext& text_shaping_context, TexturedGlyphsList& glyphs_list);
+
 	/// Called by RmlUi to determine if the text geometry is required to be re-generated. Whenever the returned version
 	/// is changed, all geometry belonging to the given face handle will be re-generated.
 	/// @param[in] face_handle The font handle.
@@ -25,6 +25,10 @@ public:
 
 	Mesh Release(ReleaseMode mode = ReleaseMode::ReturnMesh);
 
+	/// Replaces the mesh of the geometry, such as to change its vertex colours. Any compiled geometry is updated in place when supported by the
+	/// render interface, otherwise it is compiled again when next rendered.
+	void UpdateMesh(Mesh&& mesh);
+
 	const Mesh& GetMesh() const;
 
 private:
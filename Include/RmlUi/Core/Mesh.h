@@ -22,4 +22,32 @@ struct RMLUICORE_API TexturedMesh {
 
 using TexturedMeshList = Vector<TexturedMesh>;
 
+/**
+    A compact record of a single glyph, rendered as a textured quad from a glyph atlas.
+ */
+struct RMLUICORE_API GlyphInstance {
+	// The top-left corner and the size of the quad, in pixels.
+	Vector2f position;
+	Vector2f dimensions;
+	// The texture coordinates of the glyph within its atlas.
+	Vector2f top_left_texcoord;
+	Vector2f bottom_right_texcoord;
+	// Set for glyphs with colours of their own, such as emojis, which only take the alpha of the text colour.
+	bool coloured_glyph = false;
+};
+
+/**
+    A list of glyphs rendered from the same texture. The glyphs do not store their colour, instead the colour is applied when the glyphs are
+    converted to meshes, so that the text colour and opacity can change without generating the glyphs again.
+ */
+struct RMLUICORE_API TexturedGlyphs {
+	Vector<GlyphInstance> glyphs;
+	Texture texture;
+	// Set when the glyphs take the colour of the text, otherwise they take the effect colour multiplied by the text opacity.
+	bool text_colour = true;
+	Colourb effect_colour;
+};
+
+using TexturedGlyphsList = Vector<TexturedGlyphs>;
+
 } // namespace Rml
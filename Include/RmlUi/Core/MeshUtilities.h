@@ -7,6 +7,7 @@
 namespace Rml {
 
 struct Mesh;
+struct TexturedGlyphs;
 
 /**
     A class containing helper functions for generating meshes.
@@ -30,6 +31,19 @@ public:
 	static void GenerateQuad(Mesh& mesh, Vector2f origin, Vector2f dimensions, ColourbPremultiplied color, Vector2f top_left_texcoord,
 		Vector2f bottom_right_texcoord);
 
+	/// Generates a quad for each glyph in a list of glyphs.
+	/// @param[out] mesh A mesh to append the generated vertices and indices into.
+	/// @param[in] glyphs The glyphs to generate quads for.
+	/// @param[in] text_colour The colour of the text, with the text opacity applied.
+	/// @param[in] opacity The opacity of the text, applied to the colour of font effects.
+	static void GenerateGlyphs(Mesh& mesh, const TexturedGlyphs& glyphs, ColourbPremultiplied text_colour, float opacity);
+	/// Sets the vertex colours of a mesh previously generated from a list of glyphs, without generating its quads again.
+	/// @param[in,out] mesh The mesh generated from the glyphs, any vertices following the glyph quads are left untouched.
+	/// @param[in] glyphs The glyphs the mesh was generated from.
+	/// @param[in] text_colour The new colour of the text, with the text opacity applied.
+	/// @param[in] opacity The new opacity of the text, applied to the colour of font effects.
+	static void SetGlyphColours(Mesh& mesh, const TexturedGlyphs& glyphs, ColourbPremultiplied text_colour, float opacity);
+
 	/// Generates the geometry required to render a line.
 	/// @param[out] mesh A mesh to append the generated vertices and indices into.
 	/// @param[in] position The top-left position the line.
@@ -37,6 +37,8 @@ public:
 	/// @return An application-specified handle to the geometry, or zero if it could not be compiled.
 	/// @lifetime The pointed-to vertex and index data are guaranteed to be valid and immutable until ReleaseGeometry()
 	/// is called with the geometry handle returned here.
+	/// @note Each geometry is compiled separately from its own vertex and index data. The returned handle is opaque to the
+	/// library, thus the render interface is free to sub-allocate the compiled geometry from buffers shared between handles.
 	virtual CompiledGeometryHandle CompileGeometry(Span<const Vertex> vertices, Span<const int> indices) = 0;
 	/// Called by RmlUi when it wants to render geometry.
 	/// @param[in] geometry The geometry to render.
@@ -73,6 +75,20 @@ public:
 	    @name Optional functions for advanced rendering features.
 	 */
 
+	/// Called by RmlUi when it wants to replace a region of a texture previously generated from a sequence of pixels in memory.
+	/// @param[in] texture The texture handle to update, as returned from GenerateTexture().
+	/// @param[in] source The new texture data of the region, in the same format as for GenerateTexture(), with rows tightly packed.
+	/// @param[in] region The region of the texture to update, in pixels.
+	/// @return True if the texture was updated. Otherwise, the texture will be released and generated again in full.
+	virtual bool UpdateTexture(TextureHandle texture, Span<const byte> source, Rectanglei region);
+	/// Called by RmlUi when it wants to replace the vertex and index data of previously compiled geometry, such as merged geometry.
+	/// @param[in] geometry The geometry to update, as returned from CompileGeometry().
+	/// @param[in] vertices The new vertex data.
+	/// @param[in] indices The new index data.
+	/// @return True if the geometry was updated. Otherwise, the geometry will be released and compiled again.
+	/// @lifetime The pointed-to vertex and index data are guaranteed to be valid and immutable until the geometry is updated again or released.
+	virtual bool UpdateGeometry(CompiledGeometryHandle geometry, Span<const Vertex> vertices, Span<const int> indices);
+
 	/// Called by RmlUi when it wants to enable or disable the clip mask.
 	/// @param[in] enable True to enable the clip mask, false to disable it.
 	virtual void EnableClipMask(bool enable);
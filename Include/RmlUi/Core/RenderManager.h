@@ -3,6 +3,7 @@
 #include "CallbackTexture.h"
 #include "Mesh.h"
 #include "RenderInterface.h"
+#include "RenderStatistics.h"
 #include "StableVector.h"
 #include "Types.h"
 
@@ -41,6 +42,12 @@ struct RenderState {
     A wrapper over the render interface, which tracks its state and resources.
 
     All operations to be submitted to the render interface should go through this class.
+
+    When geometry batching is enabled, consecutive geometry rendered with the same texture and render state is recorded and merged into
+    a single draw call, which is submitted before the next change of state or other command. Geometry that changed or moved relative to
+    its neighbors since it was last rendered is submitted separately, so that the merged geometry around it can be retained. Merged
+    geometry is retained for as long as the same sequence of geometry is rendered again, and released after a few frames otherwise.
+    Recorded geometry is submitted at the latest when the state is reset at the end of the frame.
  */
 class RMLUICORE_API RenderManager : NonCopyMoveable {
 public:
@@ -61,10 +68,20 @@ public:
 
 	void SetTransform(const Matrix4f* new_transform);
 
+	// Enables or disables merging of consecutive geometry into single draw calls, disabled by default. When disabled, each geometry is
+	// submitted to the render interface individually. When enabled, the merged meshes are kept in memory for as long as they are compiled,
+	// in addition to the meshes of the geometry they were merged from. Only the buffers of merged meshes are pooled and reused, other
+	// geometry is still compiled from, and owned by, its own mesh.
+	void EnableGeometryBatching(bool enable);
+
+	// Returns the counters of all work submitted to the render interface since the render manager was constructed.
+	RenderStatistics GetStatistics() const;
+
 	// Retrieves the cached render state. If setting this state again, ensure the lifetimes of referenced objects are
 	// still valid. Possibly invalidating actions include destroying an element, or altering its transform property.
 	const RenderState& GetState() const { return state; }
 	void SetState(const RenderState& next);
+	// Resets the state and submits any recorded geometry to the render interface.
 	void ResetState();
 
 	Geometry MakeGeometry(Mesh&& mesh);
@@ -92,8 +109,18 @@ private:
 
 	void Render(const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
 
+	// Submits the recorded geometry to the render interface, must be called before any other command is submitted.
+	void FlushBatch();
+	void RenderBatch(size_t begin, size_t end);
+	void ReleaseUnusedBatches();
+
+	CompiledGeometryHandle CompileGeometry(const Mesh& mesh);
+	bool UpdateGeometry(CompiledGeometryHandle handle, const Mesh& mesh);
+	void ReleaseGeometry(CompiledGeometryHandle handle);
+
 	void GetTextureSourceList(StringList& source_list) const;
 	const Mesh& GetMesh(const Geometry& geometry) const;
+	void UpdateMesh(const Geometry& geometry, Mesh&& mesh);
 
 	bool ReleaseTexture(const String& texture_source);
 	void ReleaseAllTextures();
@@ -107,16 +134,49 @@ private:
 	struct GeometryData {
 		Mesh mesh;
 		CompiledGeometryHandle handle = {};
+		// Identifies the geometry and its mesh, since indices are reused after the geometry is released and meshes may be updated.
+		int generation = 0;
+		// How the geometry was last recorded for batching, to detect geometry that changed or moved relative to its neighbors since.
+		int recorded_generation = -1;
+		Vector2f recorded_translation;
+	};
+
+	struct BatchEntry {
+		StableVectorIndex index;
+		int generation;
+		Vector2f translation;
+	};
+	struct GeometryBatch {
+		// Translations are stored relative to the first entry.
+		Vector<BatchEntry> entries;
+		// The merged mesh is kept alive for as long as it is compiled, see RenderInterface::CompileGeometry().
+		Mesh mesh;
+		CompiledGeometryHandle handle = {};
+		// The frame this batch was last rendered, batches that have not been rendered for a while are released.
+		int last_used_frame = 0;
 	};
 
 	RenderInterface* render_interface = nullptr;
 
 	StableVector<GeometryData> geometry_list;
+	int geometry_generation = 0;
+
+	// Geometry recorded for the next draw call, all of which uses the same texture.
+	Vector<BatchEntry> batch_entries;
+	TextureHandle batch_texture = {};
+	bool batching_enabled = false;
+	// Compiled geometry of previously merged batches, indexed by a hash of their sequence of entries.
+	UnorderedMap<size_t, GeometryBatch> batch_cache;
+	int batch_frame = 0;
+	// Holds the buffers of a previously merged mesh, to be reused when merging the next batch.
+	Mesh batch_mesh_buffer;
 	UniquePtr<TextureDatabase> texture_database;
 
 	int compiled_filter_count = 0;
 	int compiled_shader_count = 0;
 
+	RenderStatistics statistics;
+
 	RenderState state;
 	Vector2i viewport_dimensions;
 
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Types.h"
+
+namespace Rml {
+
+/**
+    Counters of the work submitted to the render interface, and of the elements visited to produce it.
+
+    The render manager accumulates the render counters for as long as it exists, see RenderManager::GetStatistics(). The context reports the
+    counters for each frame, including the number of visited elements, see Context::GetRenderStatistics().
+ */
+struct RenderStatistics {
+	// Calls to render geometry, with or without a shader.
+	int draw_calls = 0;
+
+	int geometry_compiled = 0;
+	int geometry_updated = 0;
+	int geometry_released = 0;
+	// Size of the vertex and index data submitted to compile or update geometry.
+	size_t vertex_bytes_uploaded = 0;
+	size_t index_bytes_uploaded = 0;
+
+	// Textures loaded or generated, and partial texture updates.
+	int texture_uploads = 0;
+
+	int layers_pushed = 0;
+	int filters_compiled = 0;
+	int shaders_compiled = 0;
+
+	int scissor_changes = 0;
+	int clip_mask_changes = 0;
+	int transform_changes = 0;
+
+	// Elements visited during the context update and render, only counted by the context.
+	int elements_updated = 0;
+	int elements_rendered = 0;
+};
+
+} // namespace Rml
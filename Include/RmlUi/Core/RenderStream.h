@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Dictionary.h"
+#include "Mesh.h"
+#include "RenderInterface.h"
+
+namespace Rml {
+
+/**
+    A self-contained frame of recorded render commands, including all the data needed to play them back.
+
+    Frames are produced by the render stream recorder and consumed by the render stream player, see RenderStreamRecorder for details. The frame
+    does not reference any memory owned by the library, and can thus be freely moved to another thread.
+*/
+class RMLUICORE_API RenderStreamFrame {
+public:
+	/// Returns true if no commands were recorded in this frame.
+	bool IsEmpty() const { return commands.empty(); }
+
+private:
+	// The handles and data used by each command are listed after each type.
+	enum class CommandType : byte {
+		CompileGeometry,      // handles: new geometry; offset: mesh
+		RenderGeometry,       // handles: geometry, texture; translation
+		ReleaseGeometry,      // handles: geometry
+		UpdateGeometry,       // handles: geometry; offset: mesh
+		LoadTexture,          // handles: new texture, texture already loaded by the target render interface
+		GenerateTexture,      // handles: new texture; offset: texture data; dimensions
+		ReleaseTexture,       // handles: texture
+		EnableScissorRegion,  // value: enable
+		SetScissorRegion,     // region
+		EnableClipMask,       // value: enable
+		RenderToClipMask,     // handles: geometry; value: operation; translation
+		SetTransform,         // offset: transform, or -1 for none
+		PushLayer,            // handles: new layer
+		CompositeLayers,      // handles: source, destination; value: blend mode; offset, count: filters
+		PopLayer,             //
+		SaveLayerAsTexture,   // handles: new texture
+		SaveLayerAsMaskImage, // handles: new filter
+		CompileFilter,        // handles: new filter; offset: effect
+		ReleaseFilter,        // handles: filter
+		CompileShader,        // handles: new shader; offset: effect
+		RenderShader,         // handles: shader, geometry, texture; translation
+		ReleaseShader,        // handles: shader
+	};
+
+	struct Command {
+		CommandType type;
+		int value = 0;
+		int offset = 0;
+		int count = 0;
+		uintptr_t handles[3] = {};
+		Vector2f translation;
+		Rectanglei region;
+	};
+
+	struct Effect {
+		String name;
+		Dictionary parameters;
+	};
+
+	Vector<Command> commands;
+
+	Vector<Mesh> meshes;
+	Vector<byte> texture_data;
+	Vector<Matrix4f> transforms;
+	Vector<CompiledFilterHandle> filters;
+	Vector<Effect> effects;
+
+	friend class RenderStreamRecorder;
+	friend class RenderStreamPlayer;
+};
+
+/**
+    A render interface which records all calls into frames, to be played back later on another thread.
+
+    This allows the application to update and render the context for the next frame, while the previous frame is being submitted to the GPU
+    from a separate render thread. Handles returned by the recorder are placeholders, they are translated to the handles of the target render
+    interface during playback. The recorder and player should be used as follows.
+
+    1. Create the context using the recorder as its render interface.
+
+           Rml::RenderStreamRecorder recorder(&my_render_interface);
+           Rml::Context* context = Rml::CreateContext("main", dimensions, &recorder);
+
+    2. On the update thread, record a frame and hand it over to the render thread.
+
+           context->Update();
+           context->Render();
+           Rml::RenderStreamFrame frame = recorder.TakeFrame();
+
+    3. On the render thread, play back the frame using the target render interface.
+
+           Rml::RenderStreamPlayer player(&my_render_interface);
+           player.Play(std::move(frame));
+
+    Frames must be played back in the order they were recorded. Resources are released through the recorded commands, thus any frame recorded
+    after the context is removed and the library is shut down should also be played back.
+
+    Textures loaded from files are loaded immediately through the target render interface, since the library needs the texture dimensions
+    during the update. Thus, the target's LoadTexture() function must be safe to call from the update thread. Partial texture updates are not
+    recorded, instead such textures are generated again in full. Geometry updates are always recorded, and played back as new geometry if the
+    target render interface does not support them.
+*/
+class RMLUICORE_API RenderStreamRecorder : public RenderInterface {
+public:
+	/// Constructs the recorder.
+	/// @param[in] render_interface The target render interface, only used directly to load textures from files.
+	explicit RenderStreamRecorder(RenderInterface* render_interface);
+	~RenderStreamRecorder();
+
+	/// Returns all the commands recorded since the previous call, and starts recording a new frame.
+	RenderStreamFrame TakeFrame();
+
+	CompiledGeometryHandle CompileGeometry(Span<const Vertex> vertices, Span<const int> indices) override;
+	void RenderGeometry(CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture) override;
+	void ReleaseGeometry(CompiledGeometryHandle geometry) override;
+	bool UpdateGeometry(CompiledGeometryHandle geometry, Span<const Vertex> vertices, Span<const int> indices) override;
+
+	TextureHandle LoadTexture(Vector2i& texture_dimensions, const String& source) override;
+	TextureHandle GenerateTexture(Span<const byte> source, Vector2i source_dimensions) override;
+	void ReleaseTexture(TextureHandle texture) override;
+
+	void EnableScissorRegion(bool enable) override;
+	void SetScissorRegion(Rectanglei region) override;
+
+	void EnableClipMask(bool enable) override;
+	void RenderToClipMask(ClipMaskOperation operation, CompiledGeometryHandle geometry, Vector2f translation) override;
+
+	void SetTransform(const Matrix4f* transform) override;
+
+	LayerHandle PushLayer() override;
+	void CompositeLayers(LayerHandle source, LayerHandle destination, BlendMode blend_mode, Span<const CompiledFilterHandle> filters) override;
+	void PopLayer() override;
+
+	TextureHandle SaveLayerAsTexture() override;
+	CompiledFilterHandle SaveLayerAsMaskImage() override;
+
+	CompiledFilterHandle CompileFilter(const String& name, const Dictionary& parameters) override;
+	void ReleaseFilter(CompiledFilterHandle filter) override;
+
+	CompiledShaderHandle CompileShader(const String& name, const Dictionary& parameters) override;
+	void RenderShader(CompiledShaderHandle shader, CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture) override;
+	void ReleaseShader(CompiledShaderHandle shader) override;
+
+private:
+	using CommandType = RenderStreamFrame::CommandType;
+	using Command = RenderStreamFrame::Command;
+
+	Command& AddCommand(CommandType type, uintptr_t handle = 0);
+	uintptr_t NewHandle();
+
+	RenderInterface* render_interface;
+	RenderStreamFrame frame;
+	uintptr_t next_handle = 1;
+};
+
+/**
+    Plays back frames recorded by the render stream recorder through the target render interface.
+
+    The player keeps track of the resources created by the recorded commands, and should be used exclusively from the thread owning the target
+    render interface.
+*/
+class RMLUICORE_API RenderStreamPlayer : public NonCopyMoveable {
+public:
+	/// Constructs the player.
+	/// @param[in] render_interface The target render interface to play back the frames on.
+	explicit RenderStreamPlayer(RenderInterface* render_interface);
+	~RenderStreamPlayer();
+
+	/// Submits all the commands of the frame to the target render interface.
+	/// @param[in] frame The next recorded frame, its data is taken over by the player.
+	void Play(RenderStreamFrame frame);
+
+private:
+	// Returns the handle of the target render interface corresponding to the recorded handle, or zero if none.
+	uintptr_t Resolve(uintptr_t recorded_handle) const;
+
+	RenderInterface* render_interface;
+
+	UnorderedMap<uintptr_t, uintptr_t> handles;
+	// The mesh data of compiled geometry must be kept alive until the geometry is released, see RenderInterface::CompileGeometry().
+	UnorderedMap<uintptr_t, Mesh> meshes;
+	Vector<uintptr_t> layers;
+	FilterHandleList filters;
+};
+
+} // namespace Rml
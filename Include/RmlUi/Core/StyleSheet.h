@@ -9,6 +9,7 @@ namespace Rml {
 
 class Element;
 class ElementDefinition;
+class ElementDefinitionCache;
 class StyleSheetNode;
 class Decorator;
 class RenderManager;
@@ -51,6 +52,8 @@ public:
 	const Sprite* GetSprite(const String& name) const;
 
 	/// Returns the compiled element definition for a given element and its hierarchy.
+	/// @note Can be called concurrently from multiple threads, provided that the hierarchy is not modified meanwhile, and that the definitions of
+	/// an element's ancestors are resolved before its own.
 	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element) const;
 
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
@@ -83,8 +86,7 @@ private:
 	StyleSheetIndex styled_node_index;
 
 	// Index of node sets to element definitions.
-	using ElementDefinitionCache = UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>>;
-	mutable ElementDefinitionCache node_cache;
+	UniquePtr<ElementDefinitionCache> node_cache;
 
 	// Cached decorator instances.
 	using DecoratorCache = UnorderedMap<String, Vector<SharedPtr<const Decorator>>>;
@@ -73,11 +73,17 @@ using MediaBlockList = Vector<MediaBlock>;
  */
 struct StyleSheetIndex {
 	using NodeList = Vector<const StyleSheetNode*>;
+	// Indexed by the interned atom of the id, class, or tag name.
 	using NodeIndex = UnorderedMap<size_t, NodeList>;
 
 	// The following objects are given in prioritized order. Any nodes in the first object will not be contained in the next one and so on.
 	NodeIndex ids, classes, tags;
 	NodeList other;
+
+	// Nodes whose applicability depends on the element's position among its siblings or on its children, also contained in the above objects.
+	NodeList positional;
+	// The names of all attributes used in attribute selectors.
+	StringList attribute_names;
 };
 } // namespace Rml
 
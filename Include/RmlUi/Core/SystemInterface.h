@@ -60,6 +60,16 @@ public:
 
 	/// Deactivate keyboard (for touchscreen devices).
 	virtual void DeactivateKeyboard();
+
+	/// Get the number of worker threads available to run tasks, see RunTasks().
+	/// @return The number of workers, zero (default) disables all task-based work such as parallel style computation.
+	virtual int GetNumWorkerThreads();
+
+	/// Run the given number of independent tasks, possibly concurrently, and return once all of them have completed.
+	/// @param[in] num_tasks The number of tasks to run.
+	/// @param[in] task The function to call for each task, with the task index in the range [0, num_tasks).
+	/// @note The tasks may call into the log and font engine interfaces, access to the latter is serialized by the library.
+	virtual void RunTasks(int num_tasks, const Function<void(int)>& task);
 };
 
 } // namespace Rml
@@ -11,6 +11,7 @@
 ElementGame::ElementGame(const Rml::String& tag) : Rml::Element(tag)
 {
 	game = new Game();
+	EnableOnUpdate(true);
 }
 
 ElementGame::~ElementGame()
@@ -53,6 +54,7 @@ void ElementGame::ProcessEvent(Rml::Event& event)
 void ElementGame::OnUpdate()
 {
 	game->Update(Rml::GetSystemInterface()->GetElapsedTime());
+	DirtyRender();
 }
 
 void ElementGame::OnRender()
@@ -0,0 +1,13 @@
+#include "AncestorFilter.h"
+
+namespace Rml {
+
+static int ancestor_filter_stamp = 0;
+
+int AncestorFilter::NewStamp()
+{
+	ancestor_filter_stamp += 1;
+	return ancestor_filter_stamp;
+}
+
+} // namespace Rml
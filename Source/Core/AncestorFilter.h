@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
+
+namespace Rml {
+
+/*
+    A Bloom filter over the tag, id, and class atoms of a set of elements.
+
+    Each element keeps a filter of the names of all its ancestors, and each style sheet node keeps a filter of the names its ancestor elements
+    are required to have due to descendant and child combinators. A node can then be rejected without traversing the element's ancestors when
+    any of its required names are definitely missing. The filter may yield false positives, thus any node that passes must still be matched.
+*/
+class AncestorFilter {
+public:
+	/// Adds the given name to the filter.
+	void Insert(Atom atom)
+	{
+		if (atom == Atom::Empty)
+			return;
+		const uint32_t hash = uint32_t(atom) * 0x9E3779B1u;
+		SetBit(hash >> (32 - num_bits_log2));
+		SetBit((hash >> 8) & (num_bits - 1));
+	}
+
+	/// Adds all the names of another filter to this filter.
+	void Insert(const AncestorFilter& other)
+	{
+		for (int i = 0; i < num_words; i++)
+			words[i] |= other.words[i];
+	}
+
+	/// Returns false if any of the names in the given filter are definitely missing from this filter.
+	bool MayContainAll(const AncestorFilter& required) const
+	{
+		for (int i = 0; i < num_words; i++)
+		{
+			if ((words[i] & required.words[i]) != required.words[i])
+				return false;
+		}
+		return true;
+	}
+
+	bool IsEmpty() const
+	{
+		for (int i = 0; i < num_words; i++)
+		{
+			if (words[i])
+				return false;
+		}
+		return true;
+	}
+
+	/// Returns a new stamp to mark a change to an element's names or position in the hierarchy. Stamps are increasing, thus the ancestor filter
+	/// of an element only needs to be rebuilt if the element or any of its ancestors have been stamped after the filter was built.
+	static int NewStamp();
+
+private:
+	static constexpr int num_bits_log2 = 9;
+	static constexpr int num_bits = 1 << num_bits_log2;
+	static constexpr int num_words = num_bits / 64;
+
+	void SetBit(uint32_t bit) { words[bit / 64] |= (uint64_t(1) << (bit % 64)); }
+
+	uint64_t words[num_words] = {};
+};
+
+} // namespace Rml
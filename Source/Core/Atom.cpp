@@ -0,0 +1,69 @@
+#include "Atom.h"
+#include "ControlledLifetimeResource.h"
+
+namespace Rml {
+
+struct AtomTableData {
+	// An atom is an index into the names vector, the empty name is always the first entry.
+	StringList names = {String()};
+
+	// Reverse lookup map from name to atom.
+	UnorderedMap<String, Atom> name_lookup;
+};
+
+static ControlledLifetimeResource<AtomTableData> atom_table_data;
+
+namespace AtomTable {
+
+	void Initialize()
+	{
+		atom_table_data.Initialize();
+	}
+
+	void Shutdown()
+	{
+		atom_table_data.Shutdown();
+	}
+
+	Atom GetOrInsert(const String& name)
+	{
+		if (name.empty())
+			return Atom::Empty;
+
+		auto& names = atom_table_data->names;
+		auto& name_lookup = atom_table_data->name_lookup;
+
+		auto it = name_lookup.find(name);
+		if (it != name_lookup.end())
+			return it->second;
+
+		const Atom atom = static_cast<Atom>(names.size());
+		names.push_back(name);
+		name_lookup.emplace(name, atom);
+		return atom;
+	}
+
+	Atom Find(const String& name)
+	{
+		if (name.empty())
+			return Atom::Empty;
+
+		auto& name_lookup = atom_table_data->name_lookup;
+		auto it = name_lookup.find(name);
+		if (it != name_lookup.end())
+			return it->second;
+
+		return Atom::Empty;
+	}
+
+	const String& GetName(Atom atom)
+	{
+		auto& names = atom_table_data->names;
+		const size_t i = static_cast<size_t>(atom);
+		RMLUI_ASSERT(i < names.size());
+		return names[i];
+	}
+
+} // namespace AtomTable
+
+} // namespace Rml
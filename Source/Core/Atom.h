@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    An atom is a small integer handle to an interned name, such as the names of tags, ids, classes, and pseudo-classes.
+
+    Two names are equal if and only if their atoms are equal, which allows selector matching to compare and hash names as integers instead of
+    strings. The empty name is always represented by the 'Empty' atom.
+ */
+enum class Atom : uint32_t { Empty = 0 };
+using AtomList = Vector<Atom>;
+
+namespace AtomTable {
+
+	void Initialize();
+	void Shutdown();
+
+	// Get the atom for the given name.
+	// If not found: Inserts a new atom for the name.
+	Atom GetOrInsert(const String& name);
+
+	// Get the atom for the given name.
+	// If not found: Returns the 'Empty' atom, since no element or selector can be using the name.
+	Atom Find(const String& name);
+
+	// Get the name of the given atom.
+	const String& GetName(Atom atom);
+
+} // namespace AtomTable
+
+} // namespace Rml
@@ -18,6 +18,17 @@ Rml::CallbackTexture::operator Texture() const
 	return Texture(render_manager, resource_handle);
 }
 
+void CallbackTexture::UpdateRegion(Span<const byte> source, Rectanglei region)
+{
+	if (resource_handle != StableVectorIndex::Invalid)
+		RenderManagerAccess::UpdateTextureRegion(render_manager, resource_handle, source, region);
+}
+
+bool CallbackTexture::IsGenerated() const
+{
+	return resource_handle != StableVectorIndex::Invalid && RenderManagerAccess::IsTextureGenerated(render_manager, resource_handle);
+}
+
 CallbackTextureInterface::CallbackTextureInterface(RenderManager& render_manager, RenderInterface& render_interface, TextureHandle& texture_handle,
 	Vector2i& dimensions) : render_manager(render_manager), render_interface(render_interface), texture_handle(texture_handle), dimensions(dimensions)
 {}
@@ -35,24 +46,25 @@ bool CallbackTextureInterface::GenerateTexture(Span<const byte> source, Vector2i
 	return texture_handle != TextureHandle{};
 }
 
-void CallbackTextureInterface::SaveLayerAsTexture() const
+bool CallbackTextureInterface::SaveLayerAsTexture() const
 {
 	if (texture_handle)
 	{
 		RMLUI_ERRORMSG("Texture already set");
-		return;
+		return false;
 	}
 
 	const Rectanglei region = render_manager.GetScissorRegion();
 	if (!region.Valid())
 	{
 		RMLUI_ERRORMSG("Save layer as texture requires a scissor region to be set first");
-		return;
+		return false;
 	}
 
 	texture_handle = render_interface.SaveLayerAsTexture();
 	if (texture_handle)
 		dimensions = region.Size();
+	return texture_handle != TextureHandle{};
 }
 
 void CallbackTextureInterface::SetTextureHandle(TextureHandle handle, Vector2i new_dimensions) const
@@ -93,4 +105,10 @@ Texture CallbackTextureSource::GetTexture(RenderManager& render_manager) const
 	return Texture(texture);
 }
 
+void CallbackTextureSource::UpdateRegion(Span<const byte> source, Rectanglei region) const
+{
+	for (auto& texture : textures)
+		texture.second.UpdateRegion(source, region);
+}
+
 } // namespace Rml
@@ -5,6 +5,7 @@
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
 #include "../../Include/RmlUi/Core/Debug.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
@@ -12,7 +13,9 @@
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "DataModel.h"
+#include "ElementMeta.h"
 #include "EventDispatcher.h"
+#include "HitTestGrid.h"
 #include "PluginRegistry.h"
 #include "ScrollController.h"
 #include "StreamFile.h"
@@ -134,6 +137,7 @@ void Context::SetDimensions(const Vector2i _dimensions)
 		render_manager->SetViewport(dimensions);
 		root->SetBox(Box(Vector2f(dimensions)));
 		root->DirtyLayout();
+		RequestNextRender();
 
 		for (int i = 0; i < root->GetNumChildren(); ++i)
 		{
@@ -160,6 +164,7 @@ void Context::SetDensityIndependentPixelRatio(float dp_ratio)
 	if (density_independent_pixel_ratio != dp_ratio)
 	{
 		density_independent_pixel_ratio = dp_ratio;
+		RequestNextRender();
 
 		for (int i = 0; i < root->GetNumChildren(true); ++i)
 		{
@@ -178,6 +183,25 @@ float Context::GetDensityIndependentPixelRatio() const
 	return density_independent_pixel_ratio;
 }
 
+static RenderStatistics GetRenderStatisticsDifference(const RenderStatistics& a, const RenderStatistics& b)
+{
+	RenderStatistics result;
+	result.draw_calls = a.draw_calls - b.draw_calls;
+	result.geometry_compiled = a.geometry_compiled - b.geometry_compiled;
+	result.geometry_updated = a.geometry_updated - b.geometry_updated;
+	result.geometry_released = a.geometry_released - b.geometry_released;
+	result.vertex_bytes_uploaded = a.vertex_bytes_uploaded - b.vertex_bytes_uploaded;
+	result.index_bytes_uploaded = a.index_bytes_uploaded - b.index_bytes_uploaded;
+	result.texture_uploads = a.texture_uploads - b.texture_uploads;
+	result.layers_pushed = a.layers_pushed - b.layers_pushed;
+	result.filters_compiled = a.filters_compiled - b.filters_compiled;
+	result.shaders_compiled = a.shaders_compiled - b.shaders_compiled;
+	result.scissor_changes = a.scissor_changes - b.scissor_changes;
+	result.clip_mask_changes = a.clip_mask_changes - b.clip_mask_changes;
+	result.transform_changes = a.transform_changes - b.transform_changes;
+	return result;
+}
+
 bool Context::Update()
 {
 	RMLUI_ZoneScoped;
@@ -202,7 +226,9 @@ bool Context::Update()
 	root->dirty_definition = false;
 	root->dirty_child_definitions = false;
 
-	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	PrecomputeStyles();
+
+	root->Update(density_independent_pixel_ratio, Vector2f(dimensions), this);
 
 	for (int i = 0; i < root->GetNumChildren(); ++i)
 	{
@@ -216,6 +242,8 @@ bool Context::Update()
 	// Release any documents that were unloaded during the update.
 	ReleaseUnloadedDocuments();
 
+	UpdateDamageRegion();
+
 	return true;
 }
 
@@ -225,7 +253,7 @@ bool Context::Render()
 
 	render_manager->PrepareRender(dimensions);
 
-	root->Render();
+	root->Render(this);
 
 	// Render the cursor proxy so that any attached drag clone will be rendered below the cursor.
 	if (drag_clone)
@@ -233,11 +261,22 @@ bool Context::Render()
 		static_cast<ElementDocument&>(*cursor_proxy).UpdateDocument();
 		cursor_proxy->SetOffset(
 			Vector2f((float)Math::Clamp(mouse_position.x, 0, dimensions.x), (float)Math::Clamp(mouse_position.y, 0, dimensions.y)), nullptr);
-		cursor_proxy->Render();
+		cursor_proxy->Render(this);
 	}
 
 	render_manager->ResetState();
 
+	const RenderStatistics render_statistics = render_manager->GetStatistics();
+	frame_statistics = GetRenderStatisticsDifference(render_statistics, previous_render_statistics);
+	frame_statistics.elements_updated = num_elements_updated;
+	frame_statistics.elements_rendered = num_elements_rendered;
+	previous_render_statistics = render_statistics;
+	num_elements_updated = 0;
+	num_elements_rendered = 0;
+
+	render_required = false;
+	damage_region.clear();
+
 	return true;
 }
 
@@ -342,6 +381,7 @@ void Context::UnloadDocument(ElementDocument* _document)
 
 		// Move document to a temporary location to be released later.
 		unloaded_documents.push_back(root->RemoveChild(document));
+		RequestNextRender();
 	}
 
 	// Remove the item from the focus history.
@@ -480,6 +520,7 @@ void Context::PullDocumentToFront(ElementDocument* document)
 				root->children.insert(root->children.begin() + root->GetNumChildren(), std::move(element));
 
 				root->DirtyStackingContext();
+				RequestNextRender();
 			}
 		}
 	}
@@ -499,6 +540,7 @@ void Context::PushDocumentToBack(ElementDocument* document)
 				root->children.insert(root->children.begin(), std::move(element));
 
 				root->DirtyStackingContext();
+				RequestNextRender();
 			}
 		}
 	}
@@ -599,6 +641,10 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 			if (drag_hover && drag_verbose)
 				drag_hover->DispatchEvent(EventId::Dragmove, drag_parameters);
 		}
+
+		// The drag clone follows the mouse cursor, and is positioned during rendering.
+		if (drag_clone)
+			RequestNextRender();
 	}
 
 	return !IsMouseInteracting();
@@ -1115,6 +1161,10 @@ bool Context::RemoveDataModel(const String& name)
 
 void Context::OnElementDetach(Element* element)
 {
+	// The area previously covered by the element needs to be rendered again.
+	AddDamage(element->damage_bounds);
+	element->damage_bounds = Rectanglef::MakeInvalid();
+
 	auto it_hover = hover_chain.find(element);
 	if (it_hover != hover_chain.end())
 	{
@@ -1187,6 +1237,11 @@ void Context::OnElementDetach(Element* element)
 	}
 }
 
+void Context::OnElementRenderDirty(Element* element)
+{
+	damaged_elements.push_back(element->GetObserverPtr());
+}
+
 bool Context::OnFocusChange(Element* new_focus, bool focus_visible)
 {
 	RMLUI_ASSERT(new_focus);
@@ -1407,9 +1462,7 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		if (element->stacking_context_dirty)
 			element->BuildLocalStackingContext();
 
-		for (int i = (int)element->stacking_context.size() - 1; i >= 0; --i)
-		{
-			Element* stacking_child = element->stacking_context[i];
+		auto find_in_stacking_child = [&](Element* stacking_child) -> Element* {
 			if (ignore_element)
 			{
 				// Check if the element is a descendant of the element we're ignoring.
@@ -1423,20 +1476,36 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 				}
 
 				if (element_hierarchy)
-					continue;
+					return nullptr;
 			}
 
 			if (is_modal)
 			{
 				ElementDocument* child_document = stacking_child->GetOwnerDocument();
 				if (!child_document || !(child_document == focus_document || child_document->IsFocusableFromModal()))
-					continue;
+					return nullptr;
 			}
 
-			Element* child_element = GetElementAtPoint(point, ignore_element, stacking_child);
-			if (child_element)
-				return child_element;
+			return GetElementAtPoint(point, ignore_element, stacking_child);
+		};
+
+		// Use the hit test grid when available, to only test the stacking children located near the point.
+		Element* child_element = nullptr;
+		HitTestGrid& hit_test_grid = element->meta->hit_test_grid;
+		const bool grid_used = hit_test_grid.Update(element, dimensions) &&
+			hit_test_grid.ForEachCandidate(point, [&](int index) {
+				child_element = find_in_stacking_child(element->stacking_context[index]);
+				return child_element != nullptr;
+			});
+
+		if (!grid_used)
+		{
+			for (int i = (int)element->stacking_context.size() - 1; i >= 0 && !child_element; --i)
+				child_element = find_in_stacking_child(element->stacking_context[i]);
 		}
+
+		if (child_element)
+			return child_element;
 	}
 
 	// Ignore elements whose pointer events are disabled.
@@ -1510,6 +1579,7 @@ void Context::ReleaseDragClone()
 	{
 		cursor_proxy->RemoveChild(drag_clone);
 		drag_clone = nullptr;
+		RequestNextRender();
 		static_cast<ElementDocument&>(*cursor_proxy).SetStyleSheetContainer(nullptr);
 	}
 }
@@ -1593,6 +1663,72 @@ private:
 	ElementObserverList* elements;
 };
 
+void Context::PrecomputeStyles()
+{
+	SystemInterface* system_interface = GetSystemInterface();
+	const int num_workers = system_interface->GetNumWorkerThreads();
+	if (num_workers <= 0)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	const float dp_ratio = density_independent_pixel_ratio;
+	const Vector2f vp_dimensions(dimensions);
+
+	// Styles must be computed for parents before their children. Thus, descend the tree one level at a time on this thread, until there are
+	// enough elements to distribute among the workers. Each task then handles a range of these elements along with their descendants.
+	const int min_num_elements = 4 * num_workers;
+	Vector<Element*> parents = {root.get()};
+	Vector<Element*> elements;
+
+	while (true)
+	{
+		elements.clear();
+		for (Element* parent : parents)
+		{
+			for (const ElementPtr& child : parent->children)
+			{
+				if (child->dirty_update)
+					elements.push_back(child.get());
+			}
+		}
+
+		if (elements.empty())
+			return;
+		if ((int)elements.size() >= min_num_elements)
+			break;
+
+		parents.clear();
+		for (Element* element : elements)
+		{
+			if (element->PrecomputeStyle(dp_ratio, vp_dimensions))
+				parents.push_back(element);
+		}
+	}
+
+	const int num_elements = (int)elements.size();
+	const int num_tasks = Math::Min(num_elements, min_num_elements);
+	auto GetTaskBegin = [=](int task) { return int((int64_t)task * num_elements / num_tasks); };
+
+	// Style sharing may read from the preceding sibling of an element, which could belong to a different task. Compute the first element of
+	// each task up front to avoid such conflicts, its descendants are left to the task.
+	Vector<bool> first_elements_computed(num_tasks);
+	for (int task = 0; task < num_tasks; task++)
+		first_elements_computed[task] = elements[GetTaskBegin(task)]->PrecomputeStyle(dp_ratio, vp_dimensions);
+
+	system_interface->RunTasks(num_tasks, [&](int task) {
+		const int begin = GetTaskBegin(task);
+		const int end = GetTaskBegin(task + 1);
+		for (int i = begin; i < end; i++)
+		{
+			Element* element = elements[i];
+			const bool computed = (i == begin ? first_elements_computed[task] : element->PrecomputeStyle(dp_ratio, vp_dimensions));
+			if (computed)
+				element->PrecomputeDescendantStyles(dp_ratio, vp_dimensions);
+		}
+	});
+}
+
 void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters)
 {
 	// We put our elements in observer pointers in case some of them are deleted during dispatch.
@@ -1634,4 +1770,156 @@ double Context::GetNextUpdateDelay() const
 	return next_update_timeout;
 }
 
+void Context::RequestNextRender()
+{
+	render_required = true;
+}
+
+bool Context::IsRenderRequired() const
+{
+	return render_required || !damage_region.empty();
+}
+
+const Vector<Rectanglei>& Context::GetDamageRegion() const
+{
+	return damage_region;
+}
+
+const RenderStatistics& Context::GetRenderStatistics() const
+{
+	return frame_statistics;
+}
+
+// Returns the area covered by the element when rendered, or an invalid rectangle if the element is not rendered.
+static Rectanglef GetElementDamageBounds(Element* element, Vector2i dimensions)
+{
+	if (!element->IsVisible(true))
+		return Rectanglef::MakeInvalid();
+
+	// Text is positioned by its lines rather than by its box, instead use the block container of the text. Also include the lines themselves in
+	// case they overflow the container, extended by the font size to cover glyph overhang and font effects.
+	if (ElementText* element_text = rmlui_dynamic_cast<ElementText*>(element))
+	{
+		Element* offset_parent = element_text->GetOffsetParent();
+		if (!offset_parent)
+			return Rectanglef::MakeInvalid();
+
+		Rectanglef bounds = GetElementDamageBounds(offset_parent, dimensions);
+		const Vector2f text_offset = element_text->GetAbsoluteOffset();
+		const float font_size = element_text->GetComputedValues().font_size();
+		for (const ElementText::Line& line : element_text->GetLines())
+		{
+			const Rectanglef line_bounds = Rectanglef::FromPositionSize(text_offset + line.position, Vector2f((float)line.width, 0.f)).Extend(font_size);
+			bounds = (bounds.Valid() ? bounds.Join(line_bounds) : line_bounds);
+		}
+
+		return bounds;
+	}
+
+	// The ink overflow of filters is not known here, assume that they can extend anywhere.
+	const ComputedValues& computed = element->GetComputedValues();
+	if (computed.has_filter() || computed.has_backdrop_filter())
+		return Rectanglef::FromSize(Vector2f(dimensions));
+
+	Rectanglef bounds;
+	if (!ElementUtilities::GetBoundingBox(bounds, element, BoxArea::Auto))
+		return Rectanglef::FromSize(Vector2f(dimensions));
+
+	// Include the additional boxes of inline elements split across multiple lines.
+	const Vector2f position = element->GetAbsoluteOffset(BoxArea::Border);
+	for (int i = 1; i < element->GetNumBoxes(); i++)
+	{
+		Vector2f box_offset;
+		const Box& box = element->GetBox(i, box_offset);
+		bounds = bounds.Join(Rectanglef::FromPositionSize(position + box_offset, box.GetSize(BoxArea::Border)));
+	}
+
+	return bounds;
+}
+
+void Context::UpdateDamageRegion()
+{
+	RMLUI_ZoneScoped;
+
+	if (render_required)
+		AddDamage(Rectanglef::FromSize(Vector2f(dimensions)));
+
+	// Both the previous and the new area of each element changed. Resolving transforms may damage further elements, thus iterate by index.
+	for (size_t i = 0; i < damaged_elements.size(); i++)
+	{
+		Element* element = damaged_elements[i].get();
+		if (!element)
+			continue;
+
+		AddDamage(element->damage_bounds);
+
+		element->damage_bounds = (element->GetContext() == this ? GetDamageBounds(element) : Rectanglef::MakeInvalid());
+		element->damage_pending = false;
+		AddDamage(element->damage_bounds);
+	}
+
+	damaged_elements.clear();
+}
+
+Rectanglef Context::GetDamageBounds(Element* element)
+{
+	UpdateTransformStates(element);
+
+	Rectanglef bounds = GetElementDamageBounds(element, dimensions);
+
+	// Filters on ancestors spread the rendered content of their descendants.
+	for (Element* ancestor = element->GetParentNode(); ancestor && bounds.Valid(); ancestor = ancestor->GetParentNode())
+	{
+		if (ancestor->GetComputedValues().has_filter() && !ancestor->meta->effects.ExtendInkOverflow(bounds))
+			return Rectanglef::FromSize(Vector2f(dimensions));
+	}
+
+	return bounds;
+}
+
+void Context::UpdateTransformStates(Element* element)
+{
+	if (Element* parent = element->GetParentNode())
+		UpdateTransformStates(parent);
+	element->UpdateTransformState();
+}
+
+void Context::AddDamage(Rectanglef area)
+{
+	// Merge all rectangles into their bounds if there are too many of them, at which point the list is no longer useful to the application.
+	static constexpr size_t max_damage_rectangles = 16;
+
+	if (!area.Valid())
+		return;
+
+	Rectanglei rectangle = Rectanglei::FromCorners(                                               //
+		Vector2i(Math::RoundDownToInteger(area.Left()), Math::RoundDownToInteger(area.Top())), //
+		Vector2i(Math::RoundUpToInteger(area.Right()), Math::RoundUpToInteger(area.Bottom())));
+	rectangle = rectangle.IntersectIfValid(Rectanglei::FromSize(dimensions));
+	if (!rectangle.Valid() || rectangle.Width() == 0 || rectangle.Height() == 0)
+		return;
+
+	for (size_t i = 0; i < damage_region.size();)
+	{
+		if (damage_region[i].Intersects(rectangle))
+		{
+			// The joined rectangle may now overlap rectangles that were already visited, thus start over.
+			rectangle = rectangle.Join(damage_region[i]);
+			damage_region.erase(damage_region.begin() + i);
+			i = 0;
+		}
+		else
+			i++;
+	}
+
+	if (damage_region.size() >= max_damage_rectangles)
+	{
+		for (const Rectanglei& other : damage_region)
+			rectangle = rectangle.Join(other);
+		damage_region.clear();
+	}
+
+	damage_region.push_back(rectangle);
+}
+
 } // namespace Rml
@@ -12,6 +12,7 @@
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/TextInputHandler.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
 #include "BoxShadowCache.h"
 #include "ComputeProperty.h"
 #include "ControlledLifetimeResource.h"
@@ -125,6 +126,7 @@ bool Initialise()
 	}
 
 	EventSpecificationInterface::Initialize();
+	AtomTable::Initialize();
 
 	Detail::InitializeObserverPtrPool();
 
@@ -194,6 +196,7 @@ void Shutdown()
 
 	core_data.Shutdown();
 
+	AtomTable::Shutdown();
 	EventSpecificationInterface::Shutdown();
 
 	ShutdownComputeProperty();
@@ -38,4 +38,14 @@ void DataControllers::OnElementRemove(Element* element)
 	controllers.erase(element);
 }
 
+void DataControllers::Rebind(DataModel& model, const UnorderedSet<Element*>& elements)
+{
+	for (Element* element : elements)
+	{
+		auto range = controllers.equal_range(element);
+		for (auto it = range.first; it != range.second; ++it)
+			it->second->Rebind(model);
+	}
+}
+
 } // namespace Rml
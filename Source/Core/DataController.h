@@ -53,6 +53,10 @@ public:
 	// @return True on success.
 	virtual bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) = 0;
 
+	// Resolve the variable addresses again, after the aliases of the attached element or one of its ancestors have changed.
+	// Returns false if any address could no longer be resolved, then the previous addresses are kept.
+	virtual bool Rebind(DataModel& model) = 0;
+
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
 
@@ -75,6 +79,9 @@ public:
 
 	void OnElementRemove(Element* element);
 
+	// Rebinds the controllers attached to any of the given elements.
+	void Rebind(DataModel& model, const UnorderedSet<Element*>& elements);
+
 private:
 	using ElementControllersMap = UnorderedMultimap<Element*, DataControllerPtr>;
 	ElementControllersMap controllers;
@@ -15,19 +15,28 @@ DataControllerValue::~DataControllerValue()
 		element->RemoveEventListener(EventId::Change, this);
 }
 
-bool DataControllerValue::Initialize(DataModel& model, Element* element, const String& variable_name, const String& /*modifier*/)
+bool DataControllerValue::Initialize(DataModel& model, Element* element, const String& in_variable_name, const String& /*modifier*/)
 {
 	RMLUI_ASSERT(element);
 
-	DataAddress variable_address = model.ResolveAddress(variable_name, element);
+	variable_name = in_variable_name;
+	if (!Rebind(model))
+		return false;
+
+	element->AddEventListener(EventId::Change, this);
+
+	return true;
+}
+
+bool DataControllerValue::Rebind(DataModel& model)
+{
+	DataAddress variable_address = model.ResolveAddress(variable_name, GetElement());
 	if (variable_address.empty())
 		return false;
 
 	if (model.AllowMissingVariables() || model.GetVariable(variable_address))
 		address = std::move(variable_address);
 
-	element->AddEventListener(EventId::Change, this);
-
 	return true;
 }
 
@@ -98,6 +107,15 @@ bool DataControllerEvent::Initialize(DataModel& model, Element* element, const S
 	return true;
 }
 
+bool DataControllerEvent::Rebind(DataModel& model)
+{
+	if (!expression)
+		return false;
+
+	DataExpressionInterface expr_interface(&model, GetElement());
+	return expression->Parse(expr_interface, true);
+}
+
 void DataControllerEvent::ProcessEvent(Event& event)
 {
 	if (!expression)
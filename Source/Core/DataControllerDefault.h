@@ -20,6 +20,8 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+	bool Rebind(DataModel& model) override;
+
 private:
 	// Responds to 'Change' events.
 	void ProcessEvent(Event& event) override;
@@ -27,6 +29,7 @@ private:
 	// Delete this.
 	void Release() override;
 
+	String variable_name;
 	DataAddress address;
 };
 
@@ -37,6 +40,8 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+	bool Rebind(DataModel& model) override;
+
 protected:
 	// Responds to the event type specified in the attribute modifier.
 	void ProcessEvent(Event& event) override;
@@ -1,6 +1,7 @@
 #include "DataExpression.h"
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
 #include "../../Include/RmlUi/Core/Event.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataModel.h"
 #include <stack>
@@ -61,6 +62,13 @@ enum class Instruction {
 	CastToInt       = 'I',     //       R = (int)R
 	Jump            = 'J',     //       Jumps to instruction index D
 	JumpIfZero      = 'Z',     //       If R is false, jumps to instruction index D
+	// Specialized during compilation, for operands of known types.
+	AddNumbers      = 'a',     //       R = L + R  (L and R are numbers or booleans)
+	AddStrings      = 'c',     //       R = L + R  (L or R is a string, concatenates)
+	EqualNumbers    = 'q',     //       R = L == R  (L and R are numbers or booleans)
+	EqualStrings    = 's',     //       R = L == R  (L or R is a string)
+	NotEqualNumbers = 'n',     //       R = L != R  (L and R are numbers or booleans)
+	NotEqualStrings = 't',     //       R = L != R  (L or R is a string)
 	// clang-format on
 };
 
@@ -881,6 +889,365 @@ namespace Parse {
 
 } // namespace Parse
 
+static bool StringsEqual(const Variant& left, const Variant& right)
+{
+	if (left.GetType() == Variant::STRING && right.GetType() == Variant::STRING)
+		return left.GetReference<String>() == right.GetReference<String>();
+	return left.Get<String>() == right.Get<String>();
+}
+
+static bool IsBinaryOperator(Instruction instruction)
+{
+	switch (instruction)
+	{
+	case Instruction::Add:
+	case Instruction::Subtract:
+	case Instruction::Multiply:
+	case Instruction::Divide:
+	case Instruction::And:
+	case Instruction::Or:
+	case Instruction::Less:
+	case Instruction::LessEq:
+	case Instruction::Greater:
+	case Instruction::GreaterEq:
+	case Instruction::Equal:
+	case Instruction::NotEqual:
+	case Instruction::AddNumbers:
+	case Instruction::AddStrings:
+	case Instruction::EqualNumbers:
+	case Instruction::EqualStrings:
+	case Instruction::NotEqualNumbers:
+	case Instruction::NotEqualStrings: return true;
+	default: break;
+	}
+	return false;
+}
+
+// Applies the binary operator to the values of the L and R registers, returns the new value of the R register.
+static Variant ApplyOperator(Instruction instruction, const Variant& L, const Variant& R)
+{
+	auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
+
+	switch (instruction)
+	{
+	case Instruction::Add:
+	{
+		if (AnyString(L, R))
+			return Variant(L.Get<String>() + R.Get<String>());
+		return Variant(L.Get<double>() + R.Get<double>());
+	}
+	case Instruction::Equal:
+	{
+		if (AnyString(L, R))
+			return Variant(StringsEqual(L, R));
+		return Variant(L.Get<double>() == R.Get<double>());
+	}
+	case Instruction::NotEqual:
+	{
+		if (AnyString(L, R))
+			return Variant(!StringsEqual(L, R));
+		return Variant(L.Get<double>() != R.Get<double>());
+	}
+		// clang-format off
+	case Instruction::Subtract:        return Variant(L.Get<double>() - R.Get<double>());
+	case Instruction::Multiply:        return Variant(L.Get<double>() * R.Get<double>());
+	case Instruction::Divide:          return Variant(L.Get<double>() / R.Get<double>());
+	case Instruction::And:             return Variant(L.Get<bool>() && R.Get<bool>());
+	case Instruction::Or:              return Variant(L.Get<bool>() || R.Get<bool>());
+	case Instruction::Less:            return Variant(L.Get<double>() < R.Get<double>());
+	case Instruction::LessEq:          return Variant(L.Get<double>() <= R.Get<double>());
+	case Instruction::Greater:         return Variant(L.Get<double>() > R.Get<double>());
+	case Instruction::GreaterEq:       return Variant(L.Get<double>() >= R.Get<double>());
+	case Instruction::AddNumbers:      return Variant(L.Get<double>() + R.Get<double>());
+	case Instruction::AddStrings:      return Variant(L.Get<String>() + R.Get<String>());
+	case Instruction::EqualNumbers:    return Variant(L.Get<double>() == R.Get<double>());
+	case Instruction::EqualStrings:    return Variant(StringsEqual(L, R));
+	case Instruction::NotEqualNumbers: return Variant(L.Get<double>() != R.Get<double>());
+	case Instruction::NotEqualStrings: return Variant(!StringsEqual(L, R));
+		// clang-format on
+	default: break;
+	}
+
+	RMLUI_ERRORMSG("Instruction is not a binary operator.");
+	return Variant();
+}
+
+namespace Compile {
+
+	// The type of a value as far as it is known during compilation.
+	enum class ValueType { Unknown, Number, Boolean, String };
+
+	// The types of the registers and the stack before a given instruction.
+	struct State {
+		ValueType R = ValueType::Unknown;
+		ValueType L = ValueType::Unknown;
+		Vector<ValueType> stack;
+	};
+
+	static ValueType GetValueType(const Variant& value)
+	{
+		switch (value.GetType())
+		{
+		case Variant::BOOL: return ValueType::Boolean;
+		case Variant::STRING: return ValueType::String;
+		case Variant::FLOAT:
+		case Variant::DOUBLE:
+		case Variant::INT:
+		case Variant::INT64:
+		case Variant::UINT:
+		case Variant::UINT64: return ValueType::Number;
+		default: break;
+		}
+		return ValueType::Unknown;
+	}
+
+	static bool IsNumeric(ValueType type)
+	{
+		return type == ValueType::Number || type == ValueType::Boolean;
+	}
+
+	static ValueType Join(ValueType a, ValueType b)
+	{
+		return a == b ? a : ValueType::Unknown;
+	}
+
+	static State Join(const State& a, const State& b)
+	{
+		State result;
+		result.R = Join(a.R, b.R);
+		result.L = Join(a.L, b.L);
+		result.stack.resize(Math::Min(a.stack.size(), b.stack.size()));
+		for (size_t i = 0; i < result.stack.size(); i++)
+			result.stack[i] = Join(a.stack[i], b.stack[i]);
+		return result;
+	}
+
+	// Selects the specialized instruction for the operator, if the types of its operands make its behavior known.
+	static Instruction Specialize(Instruction instruction, ValueType left, ValueType right)
+	{
+		const bool any_string = (left == ValueType::String || right == ValueType::String);
+		const bool numeric = (IsNumeric(left) && IsNumeric(right));
+
+		switch (instruction)
+		{
+		case Instruction::Add: return any_string ? Instruction::AddStrings : (numeric ? Instruction::AddNumbers : instruction);
+		case Instruction::Equal: return any_string ? Instruction::EqualStrings : (numeric ? Instruction::EqualNumbers : instruction);
+		case Instruction::NotEqual: return any_string ? Instruction::NotEqualStrings : (numeric ? Instruction::NotEqualNumbers : instruction);
+		default: break;
+		}
+		return instruction;
+	}
+
+	static ValueType ResultType(Instruction instruction, ValueType left, ValueType right)
+	{
+		switch (instruction)
+		{
+		case Instruction::Add:
+		{
+			if (left == ValueType::String || right == ValueType::String)
+				return ValueType::String;
+			if (IsNumeric(left) && IsNumeric(right))
+				return ValueType::Number;
+			return ValueType::Unknown;
+		}
+		case Instruction::AddStrings: return ValueType::String;
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::AddNumbers: return ValueType::Number;
+		default: break;
+		}
+		return ValueType::Boolean;
+	}
+
+	static bool IsLiteralIntAddress(const DataAddress& address)
+	{
+		return address.size() == 3 && address[0].name == "literal" && address[1].name == "int";
+	}
+
+} // namespace Compile
+
+/*
+    Compiles a parsed program into an equivalent one which is cheaper to run.
+
+    Variables at literal addresses, such as the index of data-for views, are replaced by their value. Operators on literals are folded into
+    a single literal. Operators whose operand types are known from the preceding instructions are replaced by specialized instructions, for
+    which the types need not be tested during execution.
+*/
+static Program CompileProgram(const Program& program, const AddressList& addresses)
+{
+	using namespace Compile;
+
+	auto JumpTarget = [&](const InstructionData& data) { return Math::Min(data.data.Get<size_t>(0), program.size()); };
+
+	Vector<bool> is_jump_target(program.size() + 1, false);
+	for (const InstructionData& data : program)
+	{
+		if (data.instruction == Instruction::Jump || data.instruction == Instruction::JumpIfZero)
+			is_jump_target[JumpTarget(data)] = true;
+	}
+
+	Program result;
+	result.reserve(program.size());
+	// The index of the source instruction of each compiled instruction, and the index of each source instruction in the result.
+	Vector<size_t> source_indices;
+	source_indices.reserve(program.size());
+	Vector<size_t> result_indices(program.size() + 1, 0);
+
+	// Returns true if the last 'count' compiled instructions can be merged with the current one, which requires that no jumps lead to
+	// any of them except the first.
+	auto CanFold = [&](size_t count, size_t i) {
+		if (result.size() < count || is_jump_target[i])
+			return false;
+		for (size_t j = result.size() - count + 1; j < result.size(); j++)
+		{
+			if (is_jump_target[source_indices[j]])
+				return false;
+		}
+		return true;
+	};
+
+	UnorderedMap<size_t, State> jump_states;
+	State state;
+	bool reachable = true;
+
+	for (size_t i = 0; i < program.size(); i++)
+	{
+		result_indices[i] = result.size();
+
+		auto it_jump_state = jump_states.find(i);
+		if (it_jump_state != jump_states.end())
+		{
+			state = (reachable ? Join(state, it_jump_state->second) : it_jump_state->second);
+			reachable = true;
+		}
+
+		InstructionData data = program[i];
+
+		switch (data.instruction)
+		{
+		case Instruction::Push:
+		{
+			state.stack.push_back(state.R);
+			state.R = ValueType::Unknown;
+		}
+		break;
+		case Instruction::Pop:
+		{
+			ValueType value = ValueType::Unknown;
+			if (!state.stack.empty())
+			{
+				value = state.stack.back();
+				state.stack.pop_back();
+			}
+			if (Register(data.data.Get<int>(-1)) == Register::L)
+				state.L = value;
+			else
+				state.R = value;
+		}
+		break;
+		case Instruction::Literal:
+		{
+			state.R = GetValueType(data.data);
+		}
+		break;
+		case Instruction::Variable:
+		{
+			const size_t variable_index = size_t(data.data.Get<int>(-1));
+			if (variable_index < addresses.size() && IsLiteralIntAddress(addresses[variable_index]))
+				data = InstructionData{Instruction::Literal, Variant(addresses[variable_index][2].index)};
+			state.R = (data.instruction == Instruction::Literal ? ValueType::Number : ValueType::Unknown);
+		}
+		break;
+		case Instruction::Not:
+		{
+			state.R = ValueType::Boolean;
+			if (CanFold(1, i) && result.back().instruction == Instruction::Literal)
+			{
+				result.back().data = Variant(!result.back().data.Get<bool>());
+				continue;
+			}
+		}
+		break;
+		case Instruction::CastToInt:
+		{
+			state.R = ValueType::Number;
+			int value = 0;
+			if (CanFold(1, i) && result.back().instruction == Instruction::Literal && result.back().data.GetInto(value))
+			{
+				result.back().data = Variant(value);
+				continue;
+			}
+		}
+		break;
+		case Instruction::NumArguments:
+		{
+			const size_t num_arguments = Math::Min(size_t(Math::Max(data.data.Get<int>(0), 0)), state.stack.size());
+			state.stack.resize(state.stack.size() - num_arguments);
+			state.R = ValueType::Number;
+		}
+		break;
+		case Instruction::JumpIfZero:
+		case Instruction::Jump:
+		{
+			const size_t target = JumpTarget(data);
+			auto it = jump_states.find(target);
+			if (it == jump_states.end())
+				jump_states.emplace(target, state);
+			else
+				it->second = Join(it->second, state);
+
+			if (data.instruction == Instruction::Jump)
+				reachable = false;
+		}
+		break;
+		case Instruction::Assign: break;
+		default:
+		{
+			if (!IsBinaryOperator(data.instruction))
+			{
+				state.R = ValueType::Unknown;
+				break;
+			}
+
+			const ValueType left = state.L;
+			const ValueType right = state.R;
+			state.R = ResultType(data.instruction, left, right);
+
+			// Fold the pattern of two literals joined by the operator: Literal, Push, Literal, Pop (L), Operator.
+			const size_t n = result.size();
+			if (CanFold(4, i) && result[n - 4].instruction == Instruction::Literal && result[n - 3].instruction == Instruction::Push &&
+				result[n - 2].instruction == Instruction::Literal && result[n - 1].instruction == Instruction::Pop &&
+				Register(result[n - 1].data.Get<int>(-1)) == Register::L)
+			{
+				Variant value = ApplyOperator(data.instruction, result[n - 4].data, result[n - 2].data);
+				result.resize(n - 3);
+				source_indices.resize(n - 3);
+				result.back().data = std::move(value);
+				state.R = GetValueType(result.back().data);
+				continue;
+			}
+
+			data.instruction = Specialize(data.instruction, left, right);
+		}
+		break;
+		}
+
+		result.push_back(std::move(data));
+		source_indices.push_back(i);
+	}
+
+	result_indices[program.size()] = result.size();
+
+	for (InstructionData& data : result)
+	{
+		if (data.instruction == Instruction::Jump || data.instruction == Instruction::JumpIfZero)
+			data.data = Variant((uint64_t)result_indices[JumpTarget(data)]);
+	}
+
+	return result;
+}
+
 static String DumpProgram(const Program& program)
 {
 	String str;
@@ -894,8 +1261,9 @@ static String DumpProgram(const Program& program)
 
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface) :
-		program(program), addresses(addresses), expression_interface(expression_interface)
+	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface,
+		Vector<DataVariable>* root_variables = nullptr) :
+		program(program), addresses(addresses), expression_interface(expression_interface), root_variables(root_variables)
 	{}
 
 	bool Error(const String& message) const
@@ -943,11 +1311,24 @@ private:
 	const Program& program;
 	const AddressList& addresses;
 	DataExpressionInterface expression_interface;
+	Vector<DataVariable>* root_variables;
 
-	bool Execute(const Instruction instruction, const Variant& data, size_t& next_instruction)
+	Variant GetVariableValue(size_t variable_index)
 	{
-		auto AnyString = [](const Variant& v1, const Variant& v2) { return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING; };
+		const DataAddress& address = addresses[variable_index];
+		if (root_variables && variable_index < root_variables->size())
+		{
+			DataVariable& root_variable = (*root_variables)[variable_index];
+			if (!root_variable)
+				root_variable = expression_interface.GetRootVariable(address);
+			if (root_variable)
+				return expression_interface.GetValue(address, root_variable);
+		}
+		return expression_interface.GetValue(address);
+	}
 
+	bool Execute(const Instruction instruction, const Variant& data, size_t& next_instruction)
+	{
 		switch (instruction)
 		{
 		case Instruction::Push:
@@ -990,45 +1371,36 @@ private:
 		{
 			size_t variable_index = size_t(data.Get<int>(-1));
 			if (variable_index < addresses.size())
-				R = expression_interface.GetValue(addresses[variable_index]);
+				R = GetVariableValue(variable_index);
 			else
 				return Error("Variable address not found.");
 		}
 		break;
-		case Instruction::Add:
+		case Instruction::Not:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
-			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+			R = Variant(!R.Get<bool>());
 		}
 		break;
-			// clang-format off
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
-			// clang-format on
+		case Instruction::Add:
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
 		case Instruction::Equal:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
-			else
-				R = Variant(L.Get<double>() == R.Get<double>());
-		}
-		break;
 		case Instruction::NotEqual:
+		case Instruction::AddNumbers:
+		case Instruction::AddStrings:
+		case Instruction::EqualNumbers:
+		case Instruction::EqualStrings:
+		case Instruction::NotEqualNumbers:
+		case Instruction::NotEqualStrings:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
-			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+			R = ApplyOperator(instruction, L, R);
 		}
 		break;
 		case Instruction::NumArguments:
@@ -1125,15 +1497,16 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 	if (!parser.Parse(is_assignment_expression))
 		return false;
 
-	program = parser.ReleaseProgram();
 	addresses = parser.ReleaseAddresses();
+	program = CompileProgram(parser.ReleaseProgram(), addresses);
+	root_variables.assign(addresses.size(), DataVariable());
 
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	DataInterpreter interpreter(program, addresses, expression_interface, &root_variables);
 
 	if (!interpreter.Run())
 		return false;
@@ -1142,14 +1515,14 @@ bool DataExpression::Run(const DataExpressionInterface& expression_interface, Va
 	return true;
 }
 
-StringList DataExpression::GetVariableNameList() const
+AddressList DataExpression::GetVariableAddressList() const
 {
-	StringList list;
+	AddressList list;
 	list.reserve(addresses.size());
 	for (const DataAddress& address : addresses)
 	{
 		if (!address.empty())
-			list.push_back(address[0].name);
+			list.push_back(address);
 	}
 	return list;
 }
@@ -1182,6 +1555,23 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	return result;
 }
 
+DataVariable DataExpressionInterface::GetRootVariable(const DataAddress& address) const
+{
+	// Event parameters are looked up during each run, as they take precedence over model variables.
+	if (address.size() == 2 && address.front().name == "ev")
+		return DataVariable();
+
+	return data_model ? data_model->GetRootVariable(address) : DataVariable();
+}
+
+Variant DataExpressionInterface::GetValue(const DataAddress& address, DataVariable root_variable) const
+{
+	Variant result;
+	if (data_model)
+		data_model->GetVariableInto(address, root_variable, result);
+	return result;
+}
+
 bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
 {
 	bool result = false;
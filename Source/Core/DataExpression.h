@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
@@ -19,6 +20,10 @@ public:
 
 	DataAddress ParseAddress(const String& address_str) const;
 	Variant GetValue(const DataAddress& address) const;
+	// Returns the bound model variable at the root of the address, or an empty variable if the address is not backed by one.
+	DataVariable GetRootVariable(const DataAddress& address) const;
+	// Retrieves the value at the address, resolved from its previously retrieved root variable.
+	Variant GetValue(const DataAddress& address, DataVariable root_variable) const;
 	bool SetValue(const DataAddress& address, const Variant& value) const;
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result);
 	bool EventCallback(const String& name, const VariantList& arguments);
@@ -39,13 +44,15 @@ public:
 	bool Run(const DataExpressionInterface& expression_interface, Variant& out_value);
 
 	// Available after Parse()
-	StringList GetVariableNameList() const;
+	AddressList GetVariableAddressList() const;
 
 private:
 	String expression;
 
 	Program program;
 	AddressList addresses;
+	// The root variable of each address, retrieved during the first run that reads it.
+	Vector<DataVariable> root_variables;
 };
 
 } // namespace Rml
@@ -6,7 +6,7 @@
 
 namespace Rml {
 
-static DataAddress ParseAddress(const String& address_str)
+DataAddress ParseAddress(const String& address_str)
 {
 	StringList list;
 	StringUtilities::ExpandString(list, address_str, '.');
@@ -73,7 +73,7 @@ static const char* LegalVariableName(const String& name)
 	return nullptr;
 }
 
-static String DataAddressToString(const DataAddress& address)
+String DataAddressToString(const DataAddress& address)
 {
 	String result;
 	bool is_first = true;
@@ -181,6 +181,15 @@ bool DataModel::BindEventCallback(const String& name, DataEventFunc event_func)
 }
 
 bool DataModel::InsertAlias(Element* element, const String& alias_name, DataAddress replace_with_address)
+{
+	auto it_element = aliases.find(element);
+	if (it_element != aliases.end() && it_element->second.count(alias_name) == 1)
+		Log::Message(Log::LT_WARNING, "Alias name '%s' in data model already exists, replaced.", alias_name.c_str());
+
+	return ReplaceAlias(element, alias_name, std::move(replace_with_address));
+}
+
+bool DataModel::ReplaceAlias(Element* element, const String& alias_name, DataAddress replace_with_address)
 {
 	if (replace_with_address.empty() || replace_with_address.front().name.empty())
 	{
@@ -192,11 +201,6 @@ bool DataModel::InsertAlias(Element* element, const String& alias_name, DataAddr
 		Log::Message(Log::LT_WARNING, "Alias variable '%s' is shadowed by a global variable.", alias_name.c_str());
 
 	auto& map = aliases.emplace(element, SmallUnorderedMap<String, DataAddress>()).first->second;
-
-	auto it = map.find(alias_name);
-	if (it != map.end())
-		Log::Message(Log::LT_WARNING, "Alias name '%s' in data model already exists, replaced.", alias_name.c_str());
-
 	map[alias_name] = std::move(replace_with_address);
 
 	return true;
@@ -222,6 +226,24 @@ void DataModel::CopyAliases(Element* from_element, Element* to_element)
 	}
 }
 
+static void AddElementAndDescendants(UnorderedSet<Element*>& elements, Element* element)
+{
+	elements.insert(element);
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+		AddElementAndDescendants(elements, element->GetChild(i));
+}
+
+bool DataModel::RebindElements(const ElementList& root_elements)
+{
+	UnorderedSet<Element*> elements;
+	for (Element* element : root_elements)
+		AddElementAndDescendants(elements, element);
+
+	controllers->Rebind(*this, elements);
+	return views->Rebind(*this, elements);
+}
+
 DataAddress DataModel::ResolveAddress(const String& address_str, Element* element) const
 {
 	DataAddress address = ParseAddress(address_str);
@@ -272,6 +294,19 @@ DataAddress DataModel::ResolveAddress(const String& address_str, Element* elemen
 	return DataAddress();
 }
 
+// Resolves the entries of the address following the root variable.
+static DataVariable GetChildVariable(const DataAddress& address, DataVariable variable)
+{
+	for (int i = 1; i < (int)address.size() && variable; i++)
+	{
+		variable = variable.Child(address[i]);
+		if (!variable)
+			return DataVariable();
+	}
+
+	return variable;
+}
+
 DataVariable DataModel::GetVariable(const DataAddress& address) const
 {
 	if (address.empty())
@@ -279,18 +314,7 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 
 	auto it = variables.find(address.front().name);
 	if (it != variables.end())
-	{
-		DataVariable variable = it->second;
-
-		for (int i = 1; i < (int)address.size() && variable; i++)
-		{
-			variable = variable.Child(address[i]);
-			if (!variable)
-				return DataVariable();
-		}
-
-		return variable;
-	}
+		return GetChildVariable(address, it->second);
 
 	if (address[0].name == "literal")
 	{
@@ -301,6 +325,18 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	return DataVariable();
 }
 
+DataVariable DataModel::GetRootVariable(const DataAddress& address) const
+{
+	if (address.empty())
+		return DataVariable();
+
+	auto it = variables.find(address.front().name);
+	if (it != variables.end())
+		return it->second;
+
+	return DataVariable();
+}
+
 const DataEventFunc* DataModel::GetEventCallback(const String& name)
 {
 	auto it = event_callbacks.find(name);
@@ -322,6 +358,15 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 	return result;
 }
 
+bool DataModel::GetVariableInto(const DataAddress& address, DataVariable root_variable, Variant& out_value) const
+{
+	DataVariable variable = GetChildVariable(address, root_variable);
+	bool result = (variable && variable.Get(out_value));
+	if (!result && !allow_missing_variables)
+		Log::Message(Log::LT_WARNING, "Could not get value from data variable '%s'.", DataAddressToString(address).c_str());
+	return result;
+}
+
 void DataModel::DirtyVariable(const String& variable_name)
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
@@ -330,6 +375,27 @@ void DataModel::DirtyVariable(const String& variable_name)
 	dirty_variables.emplace(variable_name);
 }
 
+void DataModel::DirtyAddress(const DataAddress& address)
+{
+	if (address.empty())
+		return;
+
+	const String& variable_name = address.front().name;
+	if (address.size() == 1)
+	{
+		DirtyVariable(variable_name);
+		return;
+	}
+
+	RMLUI_ASSERTMSG(allow_missing_variables || variables.count(variable_name) == 1, "In DirtyAddress: Variable name not found among added variables.");
+
+	// The whole variable is already dirty, which includes this address.
+	if (dirty_variables.count(variable_name) == 1)
+		return;
+
+	dirty_addresses.emplace(DataAddressToString(address));
+}
+
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
@@ -345,6 +411,11 @@ void DataModel::DirtyAllVariables()
 	}
 }
 
+void DataModel::DirtyView(DataView* view)
+{
+	views->DirtyView(view);
+}
+
 bool DataModel::CallTransform(const String& name, const VariantList& arguments, Variant& out_result) const
 {
 	if (const auto transform_register = data_type_register->GetTransformFuncRegister())
@@ -372,10 +443,13 @@ void DataModel::OnElementRemove(Element* element)
 
 bool DataModel::Update(bool clear_dirty_variables)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	const bool result = views->Update(*this, dirty_variables, dirty_addresses);
 
 	if (clear_dirty_variables)
+	{
 		dirty_variables.clear();
+		dirty_addresses.clear();
+	}
 
 	return result;
 }
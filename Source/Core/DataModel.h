@@ -8,12 +8,19 @@
 
 namespace Rml {
 
+class DataView;
 class DataViews;
 class DataControllers;
 class DataVariable;
 class Element;
 class FuncDefinition;
 
+// Parses an address in the form used by data expressions, eg. 'items[3].name', without resolving any aliases.
+// Returns an empty address on error.
+DataAddress ParseAddress(const String& address_str);
+// Returns the address in the form used by data expressions, eg. 'items[3].name'.
+String DataAddressToString(const DataAddress& address);
+
 class DataModel : NonCopyMoveable {
 public:
 	DataModel(DataTypeRegister* data_type_register = nullptr, bool allow_missing_variables = false);
@@ -28,18 +35,30 @@ public:
 	bool BindEventCallback(const String& name, DataEventFunc event_func);
 
 	bool InsertAlias(Element* element, const String& alias_name, DataAddress replace_with_address);
+	// Same as InsertAlias, but expects that the alias may already exist, such as when rebinding.
+	bool ReplaceAlias(Element* element, const String& alias_name, DataAddress replace_with_address);
 	bool EraseAliases(Element* element);
 	void CopyAliases(Element* source_element, Element* target_element);
+	// Resolves the addresses of all views and controllers attached to the given elements or their descendants again, after their aliases
+	// have changed. Rebound views are updated immediately.
+	bool RebindElements(const ElementList& elements);
 
 	DataAddress ResolveAddress(const String& address_str, Element* element) const;
 	const DataEventFunc* GetEventCallback(const String& name);
 
 	DataVariable GetVariable(const DataAddress& address) const;
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
+	// Returns the bound variable named by the first entry of the address. Bound variables are never replaced, thus the result can be kept
+	// for the lifetime of the model, and used to resolve the remainder of the address below.
+	DataVariable GetRootVariable(const DataAddress& address) const;
+	bool GetVariableInto(const DataAddress& address, DataVariable root_variable, Variant& out_value) const;
 
 	void DirtyVariable(const String& variable_name);
+	void DirtyAddress(const DataAddress& address);
 	bool IsVariableDirty(const String& variable_name) const;
 	void DirtyAllVariables();
+	// Requests an update of the view during the next model update, regardless of any dirty variables.
+	void DirtyView(DataView* view);
 
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result) const;
 
@@ -61,6 +80,7 @@ private:
 
 	UnorderedMap<String, DataVariable> variables;
 	DirtyVariables dirty_variables;
+	DirtyAddresses dirty_addresses;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -15,6 +15,17 @@ void DataModelHandle::DirtyVariable(const String& variable_name)
 	model->DirtyVariable(variable_name);
 }
 
+void DataModelHandle::DirtyVariable(const String& variable_name, int index)
+{
+	model->DirtyAddress(DataAddress{DataAddressEntry(variable_name), DataAddressEntry(index)});
+	model->DirtyAddress(DataAddress{DataAddressEntry(variable_name), DataAddressEntry("size")});
+}
+
+void DataModelHandle::DirtyAddress(const DataAddress& address)
+{
+	model->DirtyAddress(address);
+}
+
 void DataModelHandle::DirtyAllVariables()
 {
 	model->DirtyAllVariables();
@@ -1,5 +1,6 @@
 #include "DataView.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "DataModel.h"
 #include <algorithm>
 
 namespace Rml {
@@ -46,6 +47,8 @@ void DataViews::Add(DataViewPtr view)
 
 void DataViews::OnElementRemove(Element* element)
 {
+	element_view_map.erase(element);
+
 	for (auto it = views.begin(); it != views.end();)
 	{
 		auto& view = *it;
@@ -59,7 +62,94 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+void DataViews::DirtyView(DataView* view)
+{
+	views_to_update.push_back(view);
+}
+
+bool DataViews::Rebind(DataModel& model, const UnorderedSet<Element*>& elements)
+{
+	// Views waiting to be added are registered by their addresses only once added, so they only need to resolve them again.
+	for (const DataViewPtr& view : views_to_add)
+	{
+		if (view->IsValid() && elements.count(view->GetElement()) == 1)
+			view->Rebind(model);
+	}
+
+	Vector<DataView*> rebind_views;
+	for (Element* element : elements)
+	{
+		auto range = element_view_map.equal_range(element);
+		for (auto it = range.first; it != range.second; ++it)
+			rebind_views.push_back(it->second);
+	}
+
+	// Rebind from the top down, so that any aliases declared by views are set before they are used by views further down the tree.
+	std::sort(rebind_views.begin(), rebind_views.end(), [](auto&& left, auto&& right) { return left->GetSortOrder() < right->GetSortOrder(); });
+
+	bool result = false;
+	for (DataView* view : rebind_views)
+	{
+		if (!view->IsValid())
+			continue;
+
+		EraseFromAddressMap(view);
+		view->Rebind(model);
+		for (const DataAddress& address : view->GetVariableAddressList())
+			address_view_map[DataAddressToString(address)].push_back(view);
+
+		result |= view->Update(model);
+	}
+
+	return result;
+}
+
+static bool IsAddressSeparator(char c)
+{
+	return c == '.' || c == '[';
+}
+
+void DataViews::CollectDirtyViews(const String& dirty_address, Vector<DataView*>& dirty_views) const
+{
+	// Parent addresses, eg. 'items' and 'items[3]' when 'items[3].name' is dirty.
+	for (size_t i = 1; i < dirty_address.size(); i++)
+	{
+		if (!IsAddressSeparator(dirty_address[i]))
+			continue;
+
+		auto it = address_view_map.find(dirty_address.substr(0, i));
+		if (it != address_view_map.end())
+			dirty_views.insert(dirty_views.end(), it->second.begin(), it->second.end());
+	}
+
+	// The address itself and its children. Skip siblings sharing the same prefix, eg. 'items[3].names' when 'items[3].name' is dirty.
+	for (auto it = address_view_map.lower_bound(dirty_address); it != address_view_map.end(); ++it)
+	{
+		const String& address = it->first;
+		if (address.compare(0, dirty_address.size(), dirty_address) != 0)
+			break;
+
+		if (address.size() == dirty_address.size() || IsAddressSeparator(address[dirty_address.size()]))
+			dirty_views.insert(dirty_views.end(), it->second.begin(), it->second.end());
+	}
+}
+
+void DataViews::EraseFromAddressMap(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+	{
+		auto it = address_view_map.find(DataAddressToString(address));
+		if (it == address_view_map.end())
+			continue;
+
+		Vector<DataView*>& address_views = it->second;
+		address_views.erase(std::remove(address_views.begin(), address_views.end(), view), address_views.end());
+		if (address_views.empty())
+			address_view_map.erase(it);
+	}
+}
+
+bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables, const DirtyAddresses& dirty_addresses)
 {
 	bool result = false;
 	size_t num_dirty_variables_prev = 0;
@@ -67,20 +157,27 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
 	// update recursively but with an upper limit. Without the loop, newly added views won't be
 	// updated until the next Update() call.
-	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size() + dirty_addresses.size()) && i < 10;
+		 i++)
 	{
-		num_dirty_variables_prev = dirty_variables.size();
+		num_dirty_variables_prev = dirty_variables.size() + dirty_addresses.size();
 
 		Vector<DataView*> dirty_views;
 
+		// Views requested during this update are left for the next one, otherwise they could keep requesting themselves.
+		if (i == 0)
+			std::swap(dirty_views, views_to_update);
+
 		if (!views_to_add.empty())
 		{
 			views.reserve(views.size() + views_to_add.size());
 			for (auto&& view : views_to_add)
 			{
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				for (const DataAddress& address : view->GetVariableAddressList())
+					address_view_map[DataAddressToString(address)].push_back(view.get());
+				if (view->IsValid())
+					element_view_map.emplace(view->GetElement(), view.get());
 
 				views.push_back(std::move(view));
 			}
@@ -88,11 +185,9 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		}
 
 		for (const String& variable_name : dirty_variables)
-		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
-		}
+			CollectDirtyViews(variable_name, dirty_views);
+		for (const String& address : dirty_addresses)
+			CollectDirtyViews(address, dirty_views);
 
 		// Remove duplicate entries
 		std::sort(dirty_views.begin(), dirty_views.end());
@@ -114,18 +209,12 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		}
 
 		// Destroy views marked for destruction
-		// @performance: Horrible...
 		if (!views_to_remove.empty())
 		{
 			for (const auto& view : views_to_remove)
 			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end();)
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
+				EraseFromAddressMap(view.get());
+				views_to_update.erase(std::remove(views_to_update.begin(), views_to_update.end(), view.get()), views_to_update.end());
 			}
 
 			views_to_remove.clear();
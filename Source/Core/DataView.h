@@ -4,6 +4,7 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "DataExpression.h"
 
 namespace Rml {
 
@@ -50,8 +51,12 @@ public:
 	// Returns true if the update resulted in a document change.
 	virtual bool Update(DataModel& model) = 0;
 
-	// Returns the list of data variable name(s) which can modify this view.
-	virtual StringList GetVariableNameList() const = 0;
+	// Resolve the variable addresses again, after the aliases of the attached element or one of its ancestors have changed.
+	// Returns false if any address could no longer be resolved, then the previous addresses are kept.
+	virtual bool Rebind(DataModel& model) = 0;
+
+	// Returns the resolved address(es) of the data variables which can modify this view.
+	virtual AddressList GetVariableAddressList() const = 0;
 
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
@@ -83,18 +88,35 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	// Updates the view during the next update, regardless of any dirty variables.
+	void DirtyView(DataView* view);
+
+	// Rebinds and updates the views attached to any of the given elements.
+	// Returns true if the update resulted in a document change.
+	bool Rebind(DataModel& model, const UnorderedSet<Element*>& elements);
+
+	bool Update(DataModel& model, const DirtyVariables& dirty_variables, const DirtyAddresses& dirty_addresses);
 
 private:
 	using DataViewList = Vector<DataViewPtr>;
 
+	// Adds the views bound to any address overlapping the dirty address, that is, the address itself, its parents, or its children.
+	void CollectDirtyViews(const String& dirty_address, Vector<DataView*>& dirty_views) const;
+	void EraseFromAddressMap(DataView* view);
+
 	DataViewList views;
 
+	// Views by their attached element, for the views in 'views'.
+	using ElementViewMap = UnorderedMultimap<Element*, DataView*>;
+	ElementViewMap element_view_map;
+
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
+	Vector<DataView*> views_to_update;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	// Views by the string form of each of their variable addresses. Being ordered, the children of an address follow directly after it.
+	using AddressViewMap = StableMap<String, Vector<DataView*>>;
+	AddressViewMap address_view_map;
 };
 
 } // namespace Rml
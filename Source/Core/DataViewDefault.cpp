@@ -1,9 +1,15 @@
 #include "DataViewDefault.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataExpression.h"
@@ -35,10 +41,17 @@ bool DataViewCommon::Initialize(DataModel& model, Element* element, const String
 	return result;
 }
 
-StringList DataViewCommon::GetVariableNameList() const
+bool DataViewCommon::Rebind(DataModel& model)
 {
 	RMLUI_ASSERT(expression);
-	return expression->GetVariableNameList();
+	DataExpressionInterface expr_interface(&model, GetElement());
+	return expression->Parse(expr_interface, false);
+}
+
+AddressList DataViewCommon::GetVariableAddressList() const
+{
+	RMLUI_ASSERT(expression);
+	return expression->GetVariableAddressList();
 }
 
 const String& DataViewCommon::GetModifier() const
@@ -338,6 +351,20 @@ bool DataViewText::Initialize(DataModel& model, Element* element, const String&
 	return true;
 }
 
+bool DataViewText::Rebind(DataModel& model)
+{
+	DataExpressionInterface expression_interface(&model, GetElement());
+
+	bool result = true;
+	for (DataEntry& entry : data_entries)
+	{
+		RMLUI_ASSERT(entry.data_expression);
+		result &= entry.data_expression->Parse(expression_interface, false);
+	}
+
+	return result;
+}
+
 bool DataViewText::Update(DataModel& model)
 {
 	bool entries_modified = false;
@@ -379,16 +406,16 @@ bool DataViewText::Update(DataModel& model)
 	return entries_modified;
 }
 
-StringList DataViewText::GetVariableNameList() const
+AddressList DataViewText::GetVariableAddressList() const
 {
-	StringList full_list;
+	AddressList full_list;
 	full_list.reserve(data_entries.size());
 
 	for (const DataEntry& entry : data_entries)
 	{
 		RMLUI_ASSERT(entry.data_expression);
 
-		StringList entry_list = entry.data_expression->GetVariableNameList();
+		AddressList entry_list = entry.data_expression->GetVariableAddressList();
 		full_list.insert(full_list.end(), MakeMoveIterator(entry_list.begin()), MakeMoveIterator(entry_list.end()));
 	}
 
@@ -426,6 +453,14 @@ String DataViewText::BuildText() const
 
 DataViewFor::DataViewFor(Element* element) : DataView(element, 0) {}
 
+DataViewFor::~DataViewFor()
+{
+	if (Element* container = virtual_scroll_container.get())
+		container->RemoveEventListener(EventId::Scroll, this);
+	if (Element* document = virtual_document.get())
+		document->RemoveEventListener(EventId::Resize, this);
+}
+
 bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& /*modifier*/)
 {
 	StringList iterator_container_pair;
@@ -465,12 +500,45 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	if (iterator_index_name.empty())
 		iterator_index_name = "it_index";
 
-	const String& container_name = iterator_container_pair.back();
+	container_name = iterator_container_pair.back();
 
 	container_address = model.ResolveAddress(container_name, element);
 	if (container_address.empty())
 		return false;
 
+	if (const Variant* key_attribute = element->GetAttribute("data-key"))
+	{
+		// The key must be given relative to the iterator, eg. 'item.id', so that it can be looked up in each entry.
+		const String key_str = StringUtilities::StripWhitespace(key_attribute->Get<String>());
+		DataAddress address = ParseAddress(key_str);
+		if (address.empty() || address.front().name != iterator_name)
+		{
+			Log::Message(Log::LT_WARNING, "Invalid data-key '%s', expected an address starting with the iterator name '%s', in data-for view on element %s",
+				key_str.c_str(), iterator_name.c_str(), element->GetAddress().c_str());
+			return false;
+		}
+
+		keyed = true;
+		key_address.assign(address.begin() + 1, address.end());
+	}
+
+	if (element->HasAttribute("data-virtual-row-height"))
+	{
+		virtual_row_height = element->GetAttribute<float>("data-virtual-row-height", 0.f);
+		virtual_overscan = Math::Max(element->GetAttribute<int>("data-virtual-overscan", 4), 0);
+		if (virtual_row_height <= 0.f)
+		{
+			Log::Message(Log::LT_WARNING, "Invalid data-virtual-row-height, expected a positive number of pixels, in data-for view on element %s",
+				element->GetAddress().c_str());
+			return false;
+		}
+		if (keyed)
+		{
+			Log::Message(Log::LT_WARNING, "The data-key attribute is ignored in virtualized data-for views, on element %s", element->GetAddress().c_str());
+			keyed = false;
+		}
+	}
+
 	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
 
 	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all
@@ -485,7 +553,8 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	attributes.reserve(element_attributes.size() - num_data_for_attributes);
 	for (const auto& attribute : element->GetAttributes())
 	{
-		if (attribute.first == "data-for" || attribute.first == "rmlui-inner-rml")
+		if (attribute.first == "data-for" || attribute.first == "data-key" || attribute.first == "rmlui-inner-rml" ||
+			StringUtilities::StartsWith(attribute.first, "data-virtual-"))
 			continue;
 		attributes.emplace(attribute.first, attribute.second);
 	}
@@ -493,12 +562,33 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	return true;
 }
 
+bool DataViewFor::Rebind(DataModel& model)
+{
+	Element* element = GetElement();
+	DataAddress new_container_address = model.ResolveAddress(container_name, element);
+	if (new_container_address.empty())
+		return false;
+
+	container_address = std::move(new_container_address);
+
+	// The views of the elements are rebound along with ours, as they are descendants of the same element.
+	for (int i = 0; i < (int)elements.size(); i++)
+		SetElementAliases(model, elements[i], elements_begin + i);
+
+	return true;
+}
+
 bool DataViewFor::Update(DataModel& model)
 {
 	DataVariable variable = model.GetVariable(container_address);
 	if (!variable)
 		return false;
 
+	if (virtual_row_height > 0.f)
+		return UpdateVirtual(model, variable);
+	if (keyed)
+		return UpdateKeyed(model, variable);
+
 	bool result = false;
 	const int size = variable.Size();
 	const int num_elements = (int)elements.size();
@@ -508,24 +598,7 @@ bool DataViewFor::Update(DataModel& model)
 	{
 		if (i >= num_elements)
 		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
-
-			DataAddress iterator_address;
-			iterator_address.reserve(container_address.size() + 1);
-			iterator_address = container_address;
-			iterator_address.push_back(DataAddressEntry(i));
-
-			DataAddress iterator_index_address = {{"literal"}, {"int"}, {i}};
-
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
-
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
-			elements.push_back(new_element);
-
-			const String* rml_contents = RMLContents();
-			elements[i]->SetInnerRML(rml_contents ? *rml_contents : "");
-
+			elements.push_back(CreateElement(model, i, element));
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
 		if (i >= size)
@@ -542,10 +615,115 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
-StringList DataViewFor::GetVariableNameList() const
+static int GetChildIndex(Element* parent, Element* child)
+{
+	const int num_children = parent->GetNumChildren();
+	for (int i = 0; i < num_children; i++)
+	{
+		if (parent->GetChild(i) == child)
+			return i;
+	}
+	return -1;
+}
+
+bool DataViewFor::UpdateKeyed(DataModel& model, const DataVariable& variable)
+{
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+
+	const int size = variable.Size();
+	const int num_elements = (int)elements.size();
+
+	StringList keys(size);
+	for (int i = 0; i < size; i++)
+	{
+		DataVariable key_variable = variable.Child(DataAddressEntry(i));
+		for (const DataAddressEntry& entry : key_address)
+			key_variable = key_variable ? key_variable.Child(entry) : DataVariable();
+
+		Variant key_value;
+		if (key_variable && key_variable.Get(key_value))
+			keys[i] = key_value.Get<String>();
+	}
+
+	// Match each entry with the existing element of the same key. Only the first of any duplicate keys is matched, the rest are recreated.
+	UnorderedMap<String, int> element_index_map;
+	element_index_map.reserve(num_elements);
+	for (int i = 0; i < num_elements; i++)
+		element_index_map.emplace(element_keys[i], i);
+
+	Vector<int> previous_indices(size, -1);
+	Vector<bool> is_element_retained(num_elements, false);
+	for (int i = 0; i < size; i++)
+	{
+		auto it = element_index_map.find(keys[i]);
+		if (it == element_index_map.end())
+			continue;
+
+		previous_indices[i] = it->second;
+		is_element_retained[it->second] = true;
+		element_index_map.erase(it);
+	}
+
+	for (int i = 0; i < num_elements; i++)
+	{
+		if (!is_element_retained[i])
+		{
+			model.EraseAliases(elements[i]);
+			parent->RemoveChild(elements[i]).reset();
+		}
+	}
+
+	// The retained elements are placed directly before our element, reorder them all at once to their new order.
+	ElementList retained_elements;
+	for (int i = 0; i < size; i++)
+	{
+		if (previous_indices[i] >= 0)
+			retained_elements.push_back(elements[previous_indices[i]]);
+	}
+	if (!retained_elements.empty())
+		parent->ReorderChildren(GetChildIndex(parent, element) - (int)retained_elements.size(), retained_elements);
+
+	ElementList new_elements(size);
+	ElementList rebind_elements;
+
+	Element* next_element = element;
+	for (int i = size - 1; i >= 0; i--)
+	{
+		const int previous_index = previous_indices[i];
+		if (previous_index < 0)
+		{
+			new_elements[i] = CreateElement(model, i, next_element);
+		}
+		else
+		{
+			Element* retained_element = elements[previous_index];
+			if (previous_index != i)
+			{
+				SetElementAliases(model, retained_element, i);
+				rebind_elements.push_back(retained_element);
+			}
+
+			new_elements[i] = retained_element;
+		}
+
+		next_element = new_elements[i];
+	}
+
+	elements = std::move(new_elements);
+	element_keys = std::move(keys);
+
+	bool result = false;
+	if (!rebind_elements.empty())
+		result = model.RebindElements(rebind_elements);
+
+	return result;
+}
+
+AddressList DataViewFor::GetVariableAddressList() const
 {
 	RMLUI_ASSERT(!container_address.empty());
-	return StringList{container_address.front().name};
+	return AddressList{container_address};
 }
 
 void DataViewFor::Release()
@@ -553,6 +731,218 @@ void DataViewFor::Release()
 	delete this;
 }
 
+static Element* CreateSpacer(Element* element)
+{
+	ElementPtr spacer_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), XMLAttributes());
+	if (!spacer_ptr)
+		return nullptr;
+
+	for (PropertyId id : {PropertyId::MarginTop, PropertyId::MarginBottom, PropertyId::PaddingTop, PropertyId::PaddingBottom, PropertyId::BorderTopWidth,
+			 PropertyId::BorderBottomWidth, PropertyId::MinHeight})
+		spacer_ptr->SetProperty(id, Property(0.f, Unit::PX));
+
+	return element->GetParentNode()->InsertBefore(std::move(spacer_ptr), element);
+}
+
+bool DataViewFor::UpdateVirtual(DataModel& model, const DataVariable& variable)
+{
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+
+	if (!virtual_spacer_top || !virtual_spacer_bottom)
+	{
+		// Any elements created before are placed between the spacers.
+		Element* spacer_top = CreateSpacer(elements.empty() ? element : elements.front());
+		Element* spacer_bottom = CreateSpacer(element);
+		if (!spacer_top || !spacer_bottom)
+			return false;
+
+		virtual_spacer_top = spacer_top->GetObserverPtr();
+		virtual_spacer_bottom = spacer_bottom->GetObserverPtr();
+	}
+
+	Element* spacer_top = virtual_spacer_top.get();
+	Element* spacer_bottom = virtual_spacer_bottom.get();
+
+	// Find the entries visible in the closest scroll container, extended by the overscan band on each side.
+	Element* container = parent;
+	while (container && container->GetComputedValues().overflow_y() == Style::Overflow::Visible)
+		container = container->GetParentNode();
+	if (!container)
+		container = parent;
+
+	ListenForVisibleRangeChanges(container);
+
+	const float scroll_top = container->GetScrollTop();
+	const float list_top = spacer_top->GetAbsoluteTop() - container->GetAbsoluteTop() - container->GetClientTop() + scroll_top;
+	const float visible_top = scroll_top - list_top;
+	const float visible_bottom = visible_top + container->GetClientHeight();
+
+	const int size = variable.Size();
+	const int begin = Math::Clamp(Math::RoundDownToInteger(visible_top / virtual_row_height) - virtual_overscan, 0, size);
+	const int end = Math::Clamp(Math::RoundUpToInteger(visible_bottom / virtual_row_height) + virtual_overscan, begin, size);
+
+	// Keep the elements of entries that are still in range, the remaining ones are free to be recycled.
+	ElementList new_elements(end - begin, nullptr);
+	ElementList free_elements;
+	for (int i = 0; i < (int)elements.size(); i++)
+	{
+		const int index = elements_begin + i;
+		if (index >= begin && index < end)
+			new_elements[index - begin] = elements[i];
+		else
+			free_elements.push_back(elements[i]);
+	}
+
+	ElementList rebind_elements;
+	for (int i = begin; i < end && !free_elements.empty(); i++)
+	{
+		Element*& new_element = new_elements[i - begin];
+		if (!new_element)
+		{
+			new_element = free_elements.back();
+			free_elements.pop_back();
+
+			SetElementAliases(model, new_element, i);
+			rebind_elements.push_back(new_element);
+		}
+	}
+
+	for (Element* free_element : free_elements)
+	{
+		model.EraseAliases(free_element);
+		parent->RemoveChild(free_element).reset();
+	}
+
+	// The remaining elements are placed between the spacers, reorder the recycled ones all at once to their new positions.
+	if (!rebind_elements.empty())
+	{
+		ElementList reordered_elements;
+		for (Element* new_element : new_elements)
+		{
+			if (new_element)
+				reordered_elements.push_back(new_element);
+		}
+		parent->ReorderChildren(GetChildIndex(parent, spacer_top) + 1, reordered_elements);
+	}
+
+	Element* next_element = spacer_bottom;
+	for (int i = end - 1; i >= begin; i--)
+	{
+		Element*& new_element = new_elements[i - begin];
+		if (!new_element)
+			new_element = CreateElement(model, i, next_element);
+
+		next_element = new_element;
+	}
+
+	const bool range_changed = (begin != elements_begin || end != elements_begin + (int)elements.size() || size != virtual_num_entries);
+
+	elements = std::move(new_elements);
+	elements_begin = begin;
+
+	if (range_changed)
+	{
+		spacer_top->SetProperty(PropertyId::Height, Property(float(begin) * virtual_row_height, Unit::PX));
+		spacer_bottom->SetProperty(PropertyId::Height, Property(float(size - end) * virtual_row_height, Unit::PX));
+		virtual_num_entries = size;
+
+		// The range was found using the layout from before the change, check it again on the next update once the new elements are laid out.
+		model.DirtyView(this);
+	}
+
+	bool result = false;
+	if (!rebind_elements.empty())
+		result = model.RebindElements(rebind_elements);
+
+	return result;
+}
+
+void DataViewFor::ListenForVisibleRangeChanges(Element* container)
+{
+	if (container != virtual_scroll_container.get())
+	{
+		if (Element* previous_container = virtual_scroll_container.get())
+			previous_container->RemoveEventListener(EventId::Scroll, this);
+
+		container->AddEventListener(EventId::Scroll, this);
+		virtual_scroll_container = container->GetObserverPtr();
+	}
+
+	Element* document = GetElement()->GetOwnerDocument();
+	if (document && document != virtual_document.get())
+	{
+		if (Element* previous_document = virtual_document.get())
+			previous_document->RemoveEventListener(EventId::Resize, this);
+
+		document->AddEventListener(EventId::Resize, this);
+		virtual_document = document->GetObserverPtr();
+	}
+}
+
+void DataViewFor::ProcessEvent(Event& event)
+{
+	// Scroll events bubble up from any scrolled descendants, only scrolling of the container itself changes the visible entries.
+	if (event == EventId::Scroll && event.GetTargetElement() != virtual_scroll_container.get())
+		return;
+
+	if (Element* element = GetElement())
+	{
+		if (DataModel* model = element->GetDataModel())
+			model->DirtyView(this);
+	}
+}
+
+Element* DataViewFor::CreateElement(DataModel& model, int index, Element* adjacent_element)
+{
+	Element* element = GetElement();
+	ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	SetElementAliases(model, new_element_ptr.get(), index);
+
+	Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), adjacent_element);
+
+	const String* rml_contents = RMLContents();
+	if (!rml_contents)
+		return new_element;
+
+	// The contents are translated for every element like SetInnerRML would, as the translation may have changed since the previous one.
+	String translated_contents;
+	if (SystemInterface* system_interface = GetSystemInterface())
+		system_interface->TranslateString(translated_contents, *rml_contents);
+	else
+		translated_contents = *rml_contents;
+
+	// Parse the contents once, then instance them from the template for every element.
+	if (!contents_template_loaded || translated_contents != contents_template_rml)
+	{
+		Context* context = element->GetContext();
+		contents_template_rml = std::move(translated_contents);
+		contents_template_loaded = true;
+		contents_template_valid = contents_template.Load(contents_template_rml, context ? context->GetDocumentsBaseTag() : "body");
+	}
+
+	if (contents_template_valid)
+		contents_template.Instance(new_element);
+	else
+		new_element->SetInnerRML(*rml_contents);
+
+	return new_element;
+}
+
+void DataViewFor::SetElementAliases(DataModel& model, Element* element, int index) const
+{
+	DataAddress iterator_address;
+	iterator_address.reserve(container_address.size() + 1);
+	iterator_address = container_address;
+	iterator_address.push_back(DataAddressEntry(index));
+
+	DataAddress iterator_index_address = {{"literal"}, {"int"}, {index}};
+
+	model.ReplaceAlias(element, iterator_name, std::move(iterator_address));
+	model.ReplaceAlias(element, iterator_index_name, std::move(iterator_index_address));
+}
+
 const String* DataViewFor::RMLContents() const
 {
 	if (Element* element = GetElement())
@@ -573,7 +963,7 @@ const String* DataViewFor::RMLContents() const
 
 DataViewAlias::DataViewAlias(Element* element) : DataView(element, 0) {}
 
-StringList DataViewAlias::GetVariableNameList() const
+AddressList DataViewAlias::GetVariableAddressList() const
 {
 	return variables;
 }
@@ -589,11 +979,24 @@ bool DataViewAlias::Initialize(DataModel& model, Element* element, const String&
 	if (address.empty())
 		return false;
 
-	variables.push_back(modifier);
+	alias_expression = expression;
+	alias_name = modifier;
+	variables.push_back(DataAddress{DataAddressEntry(modifier)});
 	model.InsertAlias(element, modifier, address);
 	return true;
 }
 
+bool DataViewAlias::Rebind(DataModel& model)
+{
+	Element* element = GetElement();
+	auto address = model.ResolveAddress(alias_expression, element);
+	if (address.empty())
+		return false;
+
+	model.ReplaceAlias(element, alias_name, address);
+	return true;
+}
+
 void DataViewAlias::Release()
 {
 	delete this;
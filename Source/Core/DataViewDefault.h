@@ -1,9 +1,11 @@
 #pragma once
 
+#include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataView.h"
+#include "NodeTemplate.h"
 
 namespace Rml {
 
@@ -17,7 +19,9 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
-	StringList GetVariableNameList() const override;
+	bool Rebind(DataModel& model) override;
+
+	AddressList GetVariableAddressList() const override;
 
 protected:
 	const String& GetModifier() const;
@@ -101,8 +105,10 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+	bool Rebind(DataModel& model) override;
+
 	bool Update(DataModel& model) override;
-	StringList GetVariableNameList() const override;
+	AddressList GetVariableAddressList() const override;
 
 protected:
 	void Release() override;
@@ -120,15 +126,18 @@ private:
 	Vector<DataEntry> data_entries;
 };
 
-class DataViewFor final : public DataView {
+class DataViewFor final : public DataView, private EventListener {
 public:
 	DataViewFor(Element* element);
+	~DataViewFor() override;
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+	bool Rebind(DataModel& model) override;
+
 	bool Update(DataModel& model) override;
 
-	StringList GetVariableNameList() const override;
+	AddressList GetVariableAddressList() const override;
 
 protected:
 	void Release() override;
@@ -136,26 +145,67 @@ protected:
 private:
 	const String* RMLContents() const;
 
+	Element* CreateElement(DataModel& model, int index, Element* adjacent_element);
+	void SetElementAliases(DataModel& model, Element* element, int index) const;
+
+	// Matches the entries to the existing elements by their keys, then moves, creates, and removes elements as needed.
+	bool UpdateKeyed(DataModel& model, const DataVariable& variable);
+	// Instances only the elements of the entries visible in the scroll container, recycling elements that scrolled out of view.
+	bool UpdateVirtual(DataModel& model, const DataVariable& variable);
+	// Listens for scrolling of the container and resizing of the document, which may change the visible entries.
+	void ListenForVisibleRangeChanges(Element* container);
+
+	// Responds to 'Scroll' and 'Resize' events when virtualized.
+	void ProcessEvent(Event& event) override;
+
+	String container_name;
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
 	ElementAttributes attributes;
 
+	// The address of the key relative to each entry, only used when the key attribute is set.
+	bool keyed = false;
+	DataAddress key_address;
+
+	// Virtualized mode, enabled by a positive row height. Spacer elements take the place of the entries which are not instanced.
+	float virtual_row_height = 0.f;
+	int virtual_overscan = 0;
+	ObserverPtr<Element> virtual_spacer_top;
+	ObserverPtr<Element> virtual_spacer_bottom;
+	ObserverPtr<Element> virtual_scroll_container;
+	ObserverPtr<Element> virtual_document;
+	// The number of entries the spacers were last sized for, or negative before then.
+	int virtual_num_entries = -1;
+
 	ElementList elements;
+	// The index of the entry of the first element, only non-zero when virtualized.
+	int elements_begin = 0;
+	// The key of each element, when keyed.
+	StringList element_keys;
+
+	// The contents of each element in pre-parsed form, and the translated RML they were parsed from.
+	NodeTemplate contents_template;
+	String contents_template_rml;
+	bool contents_template_loaded = false;
+	bool contents_template_valid = false;
 };
 
 class DataViewAlias final : public DataView {
 public:
 	DataViewAlias(Element* element);
-	StringList GetVariableNameList() const override;
+	AddressList GetVariableAddressList() const override;
 	bool Update(DataModel& model) override;
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
+	bool Rebind(DataModel& model) override;
 
 protected:
 	void Release() override;
 
 private:
-	StringList variables;
+	String alias_expression;
+	String alias_name;
+	AddressList variables;
 };
 
 } // namespace Rml
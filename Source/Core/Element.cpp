@@ -26,6 +26,8 @@
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "HitTestGrid.h"
+#include "Layout/FormattingContext.h"
 #include "Layout/LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "Pool.h"
@@ -43,6 +45,9 @@ namespace Rml {
 // Determines how many levels up in the hierarchy the OnChildAdd and OnChildRemove are called (starting at the child itself)
 static constexpr int ChildNotifyLevels = 2;
 
+// Incremented whenever an element scrolls, elements validate their absolute offset once for every change.
+static int scroll_generation = 0;
+
 // Helper function to select scroll offset delta
 static float GetScrollOffsetDelta(ScrollAlignment alignment, float begin_offset, float end_offset)
 {
@@ -72,8 +77,11 @@ RMLUI_RTTI_Define(Element)
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
 	visible(true), offset_fixed(false), absolute_offset_dirty(true), rounded_main_padding_size_dirty(true), dirty_definition(false),
-	dirty_child_definitions(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag),
-	relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0)
+	dirty_child_definitions(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false),
+	dirty_update(true), on_update_enabled(false), damage_pending(false), stacking_context_bounds_dirty(false), unclipped_scroll_content(false),
+	tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), offset_version(0),
+	offset_parent_version(0), validated_scroll_generation(0), unclipped_scroll_content_generation(-1), damage_bounds(Rectanglef::MakeInvalid()),
+	stacking_context_bounds(Rectanglef::MakeInvalid())
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
 	parent = nullptr;
@@ -119,6 +127,21 @@ Element::~Element()
 
 void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 {
+	Update(dp_ratio, vp_dimensions, GetContext());
+}
+
+void Element::Update(float dp_ratio, Vector2f vp_dimensions, Context* context)
+{
+	// Skip the whole subtree when neither this element nor any of its descendants have changed since the last update.
+	if (!dirty_update)
+		return;
+
+	// Clear the flag before doing any work, so that changes made during the update are picked up by the next update.
+	dirty_update = false;
+
+	if (context)
+		context->num_elements_updated += 1;
+
 #ifdef RMLUI_TRACY_PROFILING
 	auto name = GetAddress(false, false);
 	RMLUI_ZoneScoped;
@@ -146,38 +169,51 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	meta->effects.InstanceEffects();
 
 	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
-
-	if (!animations.empty() && IsVisible(true))
 	{
-		if (Context* ctx = GetContext())
-			ctx->RequestNextUpdate(0);
+		if (children[i]->dirty_update)
+			children[i]->Update(dp_ratio, vp_dimensions, context);
 	}
+
+	if (context && !animations.empty() && IsVisible(true))
+		context->RequestNextUpdate(0);
+
+	// Keep visiting this element for as long as it has ongoing work.
+	if (on_update_enabled || !animations.empty())
+		DirtyUpdate();
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
 {
 	UpdateDefinition();
 
+	// Include any changes from values computed ahead of the update.
+	PropertyIdSet dirty_properties = std::move(meta->precomputed_property_changes);
+	meta->precomputed_property_changes.Clear();
+
 	if (meta->style.AnyPropertiesDirty())
 	{
 		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
 		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
 
 		// Compute values and clear dirty properties
-		PropertyIdSet dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values,
+		dirty_properties |= meta->style.ComputeValues(meta->computed_values, parent_values, document_values,
 			computed_values_are_default_initialized, dp_ratio, vp_dimensions);
 
 		computed_values_are_default_initialized = false;
-
-		// Computed values are just calculated and can safely be used in OnPropertyChange.
-		// However, new properties set during this call will not be available until the next update loop.
-		if (!dirty_properties.Empty())
-			OnPropertyChange(dirty_properties);
 	}
+
+	// Computed values are just calculated and can safely be used in OnPropertyChange.
+	// However, new properties set during this call will not be available until the next update loop.
+	if (!dirty_properties.Empty())
+		OnPropertyChange(dirty_properties);
 }
 
 void Element::Render()
+{
+	Render(GetContext());
+}
+
+void Element::Render(Context* context)
 {
 #ifdef RMLUI_TRACY_PROFILING
 	auto name = GetAddress(false, false);
@@ -191,26 +227,66 @@ void Element::Render()
 		BuildLocalStackingContext();
 
 	UpdateTransformState();
+
+	// Skip the element along with its local stacking context when all of it is known to be outside the window. Custom elements are assumed to
+	// render within their bounding box, as is also assumed for the damage region.
+	Rectanglef render_bounds;
+	const bool has_render_bounds = (context && GetRenderBounds(render_bounds));
+	if (has_render_bounds && !render_bounds.Intersects(Rectanglef::FromSize(Vector2f(context->GetDimensions()))))
+		return;
+
+	if (context)
+		context->num_elements_rendered += 1;
+
 	ElementUtilities::ApplyTransform(*this);
 
-	meta->effects.RenderEffects(RenderStage::Enter);
+	// The filtered result of our stacking context can be reused from the previous frame when nothing in it has been changed since.
+	const bool content_changed = (!context || context->render_required || stacking_context_bounds_dirty || !stacking_context_bounds.Valid());
+	meta->effects.RenderEffects(RenderStage::Enter, content_changed);
+	const bool render_content = !meta->effects.IsRenderingCachedContent();
 
-	if (ElementUtilities::SetClippingRegion(this))
+	if (render_content && ElementUtilities::SetClippingRegion(this))
 	{
-		meta->background_border.Render(this);
-		meta->effects.RenderEffects(RenderStage::Decoration);
-
+		// Elements in the stacking context may be clipped differently, thus only the element's own content is culled by the scissor region.
+		const Rectanglei scissor_region = (has_render_bounds ? context->GetRenderManager().GetScissorRegion() : Rectanglei::MakeInvalid());
+		if (!scissor_region.Valid() || damage_bounds.Intersects(Rectanglef(scissor_region)))
 		{
-			RMLUI_ZoneScopedNC("OnRender", 0x228B22);
-			OnRender();
+			meta->background_border.Render(this);
+			meta->effects.RenderEffects(RenderStage::Decoration);
+
+			{
+				RMLUI_ZoneScopedNC("OnRender", 0x228B22);
+				OnRender();
+			}
 		}
 	}
 
-	for (Element* element : stacking_context)
-		element->Render();
+	if (render_content)
+	{
+		for (Element* element : stacking_context)
+			element->Render(context);
+	}
 
 	ElementUtilities::ApplyTransform(*this);
 	meta->effects.RenderEffects(RenderStage::Exit);
+
+	if (local_stacking_context && (stacking_context_bounds_dirty || !stacking_context_bounds.Valid()))
+	{
+		// All elements in the stacking context have now been updated, cache their combined area for culling the next frames.
+		Rectanglef bounds = damage_bounds;
+		bool known_bounds = (!damage_pending && damage_bounds.Valid() && !(transform_state && transform_state->GetTransform()));
+		for (Element* element : stacking_context)
+		{
+			Rectanglef element_bounds;
+			known_bounds = known_bounds && element->GetRenderBounds(element_bounds);
+			if (!known_bounds)
+				break;
+			bounds = bounds.Join(element_bounds);
+		}
+
+		stacking_context_bounds = (known_bounds ? bounds : Rectanglef::MakeInvalid());
+		stacking_context_bounds_dirty = !known_bounds;
+	}
 }
 
 ElementPtr Element::Clone() const
@@ -311,7 +387,7 @@ String Element::GetAddress(bool include_pseudo_classes, bool include_parents) co
 		for (auto& pseudo_class : pseudo_classes)
 		{
 			address += ":";
-			address += pseudo_class.first;
+			address += AtomTable::GetName(pseudo_class.first);
 		}
 	}
 
@@ -332,6 +408,9 @@ void Element::SetOffset(Vector2f offset, Element* _offset_parent, bool _offset_f
 	// updated based on our left / right / top / bottom properties.
 	if (relative_offset_base != offset || offset_parent != _offset_parent || offset_fixed != _offset_fixed)
 	{
+		if (offset_fixed != _offset_fixed && owner_document)
+			owner_document->unclipped_scroll_content_generation += 1;
+
 		relative_offset_base = offset;
 		offset_fixed = _offset_fixed;
 		offset_parent = _offset_parent;
@@ -366,6 +445,20 @@ Vector2f Element::GetAbsoluteOffset(BoxArea area)
 
 void Element::UpdateAbsoluteOffsetAndRenderBoxData()
 {
+	// Elements are not dirtied when any of their ancestors scroll, instead check if the offset of our offset parent changed since we last
+	// calculated our offset. Only done once after each scroll, by then the offset parent has validated its own offset in the same way.
+	bool moved_by_scrolling = false;
+	if (!absolute_offset_dirty && offset_parent && validated_scroll_generation != scroll_generation)
+	{
+		validated_scroll_generation = scroll_generation;
+		offset_parent->UpdateAbsoluteOffsetAndRenderBoxData();
+		if (offset_parent->offset_version != offset_parent_version)
+		{
+			absolute_offset_dirty = true;
+			moved_by_scrolling = true;
+		}
+	}
+
 	if (absolute_offset_dirty || rounded_main_padding_size_dirty)
 	{
 		absolute_offset_dirty = false;
@@ -373,7 +466,11 @@ void Element::UpdateAbsoluteOffsetAndRenderBoxData()
 
 		Vector2f offset_from_ancestors;
 		if (offset_parent)
+		{
 			offset_from_ancestors = offset_parent->GetAbsoluteOffset(BoxArea::Border);
+			offset_parent_version = offset_parent->offset_version;
+		}
+		validated_scroll_generation = scroll_generation;
 
 		if (!offset_fixed)
 		{
@@ -387,8 +484,30 @@ void Element::UpdateAbsoluteOffsetAndRenderBoxData()
 		}
 
 		const Vector2f relative_offset = relative_offset_base + relative_offset_position;
+		const Vector2f old_absolute_offset = absolute_offset;
 		absolute_offset = relative_offset + offset_from_ancestors;
 
+		if (absolute_offset != old_absolute_offset)
+		{
+			offset_version += 1;
+
+			// When moved by scrolling, all of the element moves along, thus our previous area can be moved rather than calculated again. The
+			// area of filters is not known, and the area of local stacking contexts may include elements that did not move.
+			if (moved_by_scrolling)
+			{
+				const ComputedValues& computed = meta->computed_values;
+				if (computed.has_filter() || computed.has_backdrop_filter())
+					damage_bounds = Rectanglef::MakeInvalid();
+				else if (damage_bounds.Valid())
+					damage_bounds = damage_bounds.Translate(absolute_offset - old_absolute_offset);
+
+				if (local_stacking_context)
+					stacking_context_bounds_dirty = true;
+				if (transform_state)
+					DirtyTransformState(true, true);
+			}
+		}
+
 		// Next, we find the rounded size of the box so that elements can be placed border-to-border next to each other
 		// without any gaps. To achieve this, we have to adjust their rounded/rendered sizes based on their position, in
 		// such a way that the bottom-right of this element exactly matches the top-left of the next element. The order
@@ -442,6 +561,8 @@ void Element::SetBox(const Box& box)
 
 		main_box = box;
 		additional_boxes.clear();
+		HitTestGrid::InvalidateElement(this);
+		DirtyRender();
 
 		OnResize();
 		rounded_main_padding_size_dirty = true;
@@ -457,6 +578,8 @@ void Element::SetBox(const Box& box)
 void Element::AddBox(const Box& box, Vector2f offset)
 {
 	additional_boxes.emplace_back(PositionedBox{box, offset});
+	HitTestGrid::InvalidateElement(this);
+	DirtyRender();
 	OnResize();
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
@@ -838,7 +961,7 @@ StringList Element::GetActivePseudoClasses() const
 	names.reserve(pseudo_classes.size());
 	for (auto& pseudo_class : pseudo_classes)
 	{
-		names.push_back(pseudo_class.first);
+		names.push_back(AtomTable::GetName(pseudo_class.first));
 	}
 
 	return names;
@@ -1006,7 +1129,7 @@ void Element::SetScrollLeft(float scroll_left)
 	{
 		scroll_offset.x = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::HORIZONTAL);
-		DirtyAbsoluteOffset();
+		DirtyScrollOffset();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -1024,7 +1147,7 @@ void Element::SetScrollTop(float scroll_top)
 	{
 		scroll_offset.y = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::VERTICAL);
-		DirtyAbsoluteOffset();
+		DirtyScrollOffset();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -1690,6 +1813,13 @@ void Element::ForceLocalStackingContext()
 	DirtyStackingContext();
 }
 
+void Element::EnableOnUpdate(bool enable)
+{
+	on_update_enabled = enable;
+	if (enable)
+		DirtyUpdate();
+}
+
 void Element::OnUpdate() {}
 
 void Element::OnRender() {}
@@ -1704,6 +1834,8 @@ void Element::OnStyleSheetChange() {}
 
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
+	DirtyRender();
+
 	for (const auto& element_attribute : changed_attributes)
 	{
 		const auto& attribute = element_attribute.first;
@@ -1711,6 +1843,7 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		if (attribute == "id")
 		{
 			id = value.Get<String>();
+			meta->style.SetId(id);
 		}
 		else if (attribute == "class")
 		{
@@ -1809,6 +1942,8 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
+	DirtyRender();
+
 	const bool top_right_bottom_left_changed = (           //
 		changed_properties.Contains(PropertyId::Top) ||    //
 		changed_properties.Contains(PropertyId::Right) ||  //
@@ -1883,6 +2018,17 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	const bool transform_changed = changed_properties.Contains(PropertyId::Transform) || changed_properties.Contains(PropertyId::TransformOriginX) ||
 		changed_properties.Contains(PropertyId::TransformOriginY) || changed_properties.Contains(PropertyId::TransformOriginZ);
 
+	// These properties change how all descendants are rendered, even when their own boxes and properties remain unchanged.
+	if (filter_or_mask_changed || perspective_changed || transform_changed || changed_properties.Contains(PropertyId::Display) ||
+		changed_properties.Contains(PropertyId::Visibility) || changed_properties.Contains(PropertyId::Clip) ||
+		changed_properties.Contains(PropertyId::OverflowX) || changed_properties.Contains(PropertyId::OverflowY))
+	{
+		DirtyRenderRecursive();
+	}
+
+	if (changed_properties.Contains(PropertyId::Clip) && owner_document)
+		owner_document->unclipped_scroll_content_generation += 1;
+
 	// Update the z-index and stacking context.
 	if (changed_properties.Contains(PropertyId::ZIndex) || filter_or_mask_changed || perspective_changed || transform_changed)
 	{
@@ -1905,6 +2051,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 				// local stacking context.
 				stacking_context.clear();
 				stacking_context_dirty = local_stacking_context;
+				stacking_context_bounds = Rectanglef::MakeInvalid();
 			}
 
 			// When our z-index or local stacking context changes, then we must dirty our parent stacking context so we are re-indexed.
@@ -1968,11 +2115,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
 		dirty_animation = true;
+		DirtyUpdate();
 	}
 	// Check for `transition' changes
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		DirtyUpdate();
 	}
 }
 
@@ -1984,8 +2133,24 @@ void Element::OnChildRemove(Element* /*child*/) {}
 
 void Element::DirtyLayout()
 {
-	if (Element* document = GetOwnerDocument())
-		document->DirtyLayout();
+	// Any stored formatting results of this element or its ancestors may be affected by the change.
+	FormattingContext::InvalidateFormattingCache(this);
+
+	ElementDocument* document = GetOwnerDocument();
+	if (!document || document->IsLayoutDirty())
+		return;
+
+	// Changes to this element may affect its own box, but they cannot affect anything outside its nearest layout boundary.
+	for (Element* ancestor = parent; ancestor && ancestor != document; ancestor = ancestor->parent)
+	{
+		if (LayoutEngine::IsLayoutBoundary(ancestor))
+		{
+			document->DirtyLayoutBoundary(ancestor);
+			return;
+		}
+	}
+
+	document->DirtyLayoutFromDescendant();
 }
 
 bool Element::IsLayoutDirty()
@@ -2167,6 +2332,49 @@ void Element::SetDataModel(DataModel* new_data_model)
 		child->SetDataModel(new_data_model);
 }
 
+void Element::ReorderChildren(int child_index, const ElementList& new_order)
+{
+	const int num_reordered = (int)new_order.size();
+	if (child_index < 0 || child_index + num_reordered > GetNumChildren())
+	{
+		RMLUI_ERRORMSG("Reordered children out of range.");
+		return;
+	}
+
+	UnorderedMap<Element*, int> previous_positions;
+	previous_positions.reserve(num_reordered);
+	for (int i = 0; i < num_reordered; i++)
+		previous_positions.emplace(children[child_index + i].get(), i);
+
+	Vector<int> positions(num_reordered);
+	bool order_changed = false;
+	for (int i = 0; i < num_reordered; i++)
+	{
+		auto it = previous_positions.find(new_order[i]);
+		if (it == previous_positions.end())
+		{
+			RMLUI_ERRORMSG("Reordered children must consist of the children in the range, each exactly once.");
+			return;
+		}
+		positions[i] = it->second;
+		order_changed |= (it->second != i);
+		previous_positions.erase(it);
+	}
+
+	if (!order_changed)
+		return;
+
+	Vector<ElementPtr> reordered_children(num_reordered);
+	for (int i = 0; i < num_reordered; i++)
+		reordered_children[i] = std::move(children[child_index + positions[i]]);
+	std::move(reordered_children.begin(), reordered_children.end(), children.begin() + child_index);
+
+	DirtyLayout();
+	DirtyStackingContext();
+	// The new order may change which tree-structural selectors such as ':first-child' apply to our children.
+	DirtyDefinition(DirtyNodes::Self);
+}
+
 void Element::Release()
 {
 	if (instancer)
@@ -2180,8 +2388,15 @@ void Element::SetParent(Element* _parent)
 	// Assumes we are already detached from the hierarchy or we are detaching now.
 	RMLUI_ASSERT(!parent || !_parent);
 
+	// Detaching may shift the remaining children while the parent is iterating over them during update, so make sure they are visited again.
+	if (parent)
+		parent->DirtyUpdate();
+
 	parent = _parent;
 
+	// The ancestor names of this element and all its descendants have changed.
+	meta->style.DirtyAncestorFilter();
+
 	if (parent)
 	{
 		// We need to update our definition and make sure we inherit the properties of our new parent.
@@ -2194,6 +2409,8 @@ void Element::SetParent(Element* _parent)
 		DirtyTransformState(true, true);
 
 	SetOwnerDocument(parent ? parent->GetOwnerDocument() : nullptr, false);
+	if (owner_document)
+		owner_document->unclipped_scroll_content_generation += 1;
 
 	if (!parent)
 	{
@@ -2224,15 +2441,20 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyAbsoluteOffset()
 {
+	DirtyRender();
+
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
 }
 
 void Element::DirtyAbsoluteOffsetRecursive()
 {
+	DirtyRender();
+
 	if (!absolute_offset_dirty)
 	{
 		absolute_offset_dirty = true;
+		HitTestGrid::InvalidateElement(this);
 
 		if (transform_state)
 			DirtyTransformState(true, true);
@@ -2242,6 +2464,58 @@ void Element::DirtyAbsoluteOffsetRecursive()
 		children[i]->DirtyAbsoluteOffsetRecursive();
 }
 
+void Element::DirtyScrollOffset()
+{
+	// Dirty all scrolled elements right away if they are not clipped by us, otherwise our own area covers the damage of all the moved elements.
+	const ComputedValues& computed = meta->computed_values;
+	if (computed.overflow_x() == Style::Overflow::Visible || computed.overflow_y() == Style::Overflow::Visible || HasUnclippedScrollContent())
+	{
+		DirtyAbsoluteOffset();
+		return;
+	}
+
+	HitTestGrid::InvalidateDescendants(this);
+	DirtyRender();
+
+	offset_version += 1;
+	scroll_generation += 1;
+}
+
+bool Element::HasUnclippedScrollContent()
+{
+	if (!owner_document)
+		return false;
+
+	// Searching the descendants is only done once for each change to the relevant properties of any element in the document.
+	if (unclipped_scroll_content_generation != owner_document->unclipped_scroll_content_generation)
+	{
+		unclipped_scroll_content_generation = owner_document->unclipped_scroll_content_generation;
+		unclipped_scroll_content = false;
+
+		Vector<Element*> elements = {this};
+		while (!elements.empty() && !unclipped_scroll_content)
+		{
+			Element* element = elements.back();
+			elements.pop_back();
+
+			for (const ElementPtr& child : element->children)
+			{
+				// Elements with fixed offsets, such as scrollbars, are not moved by scrolling. Otherwise, elements may ignore our clipping region
+				// either directly or by skipping a number of clipping ancestors.
+				const Style::Clip clip = child->meta->computed_values.clip();
+				if (!child->offset_fixed && (clip == Style::Clip::Type::None || clip.GetNumber() > 0))
+				{
+					unclipped_scroll_content = true;
+					break;
+				}
+				elements.push_back(child.get());
+			}
+		}
+	}
+
+	return unclipped_scroll_content;
+}
+
 void Element::UpdateOffset()
 {
 	using namespace Style;
@@ -2364,6 +2638,7 @@ static void StackingContext_MakeAtomicRange(Vector<StackingContextChild>& stacki
 void Element::BuildLocalStackingContext()
 {
 	stacking_context_dirty = false;
+	meta->hit_test_grid.Invalidate();
 
 	Vector<StackingContextChild> stacking_children;
 	AddChildrenToStackingContext(stacking_children);
@@ -2485,6 +2760,26 @@ void Element::DirtyStackingContext()
 {
 	if (Element* stacking_context_parent = ClosestStackingContextContainer())
 		stacking_context_parent->stacking_context_dirty = true;
+	DirtyRender();
+}
+
+bool Element::GetRenderBounds(Rectanglef& out_bounds) const
+{
+	// The damage bounds are only up-to-date after the context update, and culling is not attempted for transformed elements.
+	if (damage_pending || !damage_bounds.Valid() || (transform_state && transform_state->GetTransform()))
+		return false;
+
+	if (!local_stacking_context)
+	{
+		out_bounds = damage_bounds;
+		return true;
+	}
+
+	if (stacking_context_bounds_dirty || !stacking_context_bounds.Valid())
+		return false;
+
+	out_bounds = stacking_context_bounds;
+	return true;
 }
 
 Element* Element::ClosestStackingContextContainer()
@@ -2510,28 +2805,102 @@ void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 			parent->dirty_child_definitions = true;
 		break;
 	}
+
+	DirtyUpdate();
 }
 
-void Element::UpdateDefinition()
+bool Element::UpdateDefinition(bool allow_transitions)
 {
 	if (dirty_definition)
 	{
+		if (!GetStyle()->UpdateDefinition(allow_transitions))
+			return false;
+
 		dirty_definition = false;
 
 		// Dirty definition implies all our descendent elements. Anything that can change the definition of this element can also change the
 		// definition of any descendants due to the presence of RCSS descendant or child combinators. In principle this also applies to sibling
 		// combinators, but those are handled during the DirtyDefinition call.
 		dirty_child_definitions = true;
-
-		GetStyle()->UpdateDefinition();
 	}
 
 	if (dirty_child_definitions)
 	{
 		dirty_child_definitions = false;
 		for (const ElementPtr& child : children)
+		{
 			child->dirty_definition = true;
+			child->DirtyUpdate();
+		}
 	}
+
+	return true;
+}
+
+bool Element::PrecomputeStyle(const float dp_ratio, const Vector2f vp_dimensions)
+{
+	// Starting transitions involves the animation system, which is not safe to use concurrently. Instead, leave this to the update.
+	if (!UpdateDefinition(false))
+		return false;
+
+	if (meta->style.AnyPropertiesDirty())
+	{
+		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
+		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
+
+		meta->precomputed_property_changes |= meta->style.ComputeValues(meta->computed_values, parent_values, document_values,
+			computed_values_are_default_initialized, dp_ratio, vp_dimensions);
+
+		computed_values_are_default_initialized = false;
+	}
+
+	return true;
+}
+
+void Element::PrecomputeDescendantStyles(const float dp_ratio, const Vector2f vp_dimensions)
+{
+	for (const ElementPtr& child : children)
+	{
+		if (child->dirty_update && child->PrecomputeStyle(dp_ratio, vp_dimensions))
+			child->PrecomputeDescendantStyles(dp_ratio, vp_dimensions);
+	}
+}
+
+void Element::DirtyUpdate()
+{
+	for (Element* element = this; element && !element->dirty_update; element = element->parent)
+		element->dirty_update = true;
+}
+
+void Element::DirtyRender()
+{
+	if (damage_pending)
+		return;
+
+	if (Context* context = GetContext())
+	{
+		damage_pending = true;
+		context->OnElementRenderDirty(this);
+
+		// The area covered by the enclosing stacking contexts may change too. Ancestors of dirty stacking contexts are already dirty.
+		for (Element* element = this; element; element = element->parent)
+		{
+			if (element->local_stacking_context)
+			{
+				if (element->stacking_context_bounds_dirty)
+					break;
+				element->stacking_context_bounds_dirty = true;
+			}
+		}
+	}
+}
+
+void Element::DirtyRenderRecursive()
+{
+	DirtyRender();
+
+	for (const ElementPtr& child : children)
+		child->DirtyRenderRecursive();
 }
 
 bool Element::Animate(const String& property_name, const Property& target_value, float duration, Tween tween, int num_iterations,
@@ -2603,6 +2972,7 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 	{
 		animations.emplace_back();
 		it = animations.end() - 1;
+		DirtyUpdate();
 	}
 
 	Property value;
@@ -2675,6 +3045,7 @@ bool Element::StartTransition(const Transition& transition, const Property& star
 		// Add transition as new animation
 		animations.push_back(ElementAnimation{transition.id, ElementAnimationOrigin::Transition, start_value, *this, start_time, 0.0f, 1, false});
 		it = (animations.end() - 1);
+		DirtyUpdate();
 	}
 	else
 	{
@@ -2885,6 +3256,8 @@ void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 {
 	dirty_perspective |= perspective_dirty;
 	dirty_transform |= transform_dirty;
+	HitTestGrid::InvalidateElement(this);
+	DirtyRender();
 }
 
 void Element::UpdateTransformState()
@@ -3028,11 +3401,13 @@ void Element::UpdateTransformState()
 		perspective_or_transform_changed |= (had_transform != have_transform);
 	}
 
-	// A change in perspective or transform will require an update to children transforms as well.
+	// A change in perspective or transform will require an update to children transforms as well. Our own bounds are no longer valid for
+	// culling, and need to be damaged again.
 	if (perspective_or_transform_changed)
 	{
 		for (Element* stacking_child : stacking_context)
 			stacking_child->DirtyTransformState(false, true);
+		DirtyRender();
 	}
 
 	// No reason to keep the transform state around if transform and perspective have been removed.
@@ -3045,6 +3420,7 @@ void Element::UpdateTransformState()
 void Element::OnStyleSheetChangeRecursive()
 {
 	meta->effects.DirtyEffects();
+	DirtyUpdate();
 
 	OnStyleSheetChange();
 
@@ -3057,6 +3433,7 @@ void Element::OnStyleSheetChangeRecursive()
 void Element::OnDpRatioChangeRecursive()
 {
 	meta->effects.DirtyEffects();
+	DirtyUpdate();
 	GetStyle()->DirtyPropertiesWithUnits(Unit::DP_SCALABLE_LENGTH);
 
 	OnDpRatioChange();
@@ -3088,7 +3465,7 @@ void Element::ClampScrollOffset()
 	if (new_scroll_offset != scroll_offset)
 	{
 		scroll_offset = new_scroll_offset;
-		DirtyAbsoluteOffset();
+		DirtyScrollOffset();
 	}
 
 	// At this point the scrollbars have been resolved, both in terms of size and visibility. Update their properties
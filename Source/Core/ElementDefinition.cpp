@@ -8,7 +8,10 @@ ElementDefinition::ElementDefinition(const Vector<const StyleSheetNode*>& style_
 {
 	// Initialises the element definition from the list of style sheet nodes.
 	for (size_t i = 0; i < style_sheet_nodes.size(); ++i)
+	{
 		properties.Merge(style_sheet_nodes[i]->GetProperties());
+		positional |= style_sheet_nodes[i]->IsPositional();
+	}
 
 	for (auto& property : properties.GetProperties())
 		property_ids.Insert(property.first);
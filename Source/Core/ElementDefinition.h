@@ -28,9 +28,13 @@ public:
 
 	const PropertyDictionary& GetProperties() const { return properties; }
 
+	/// Returns true if any of the style sheet nodes of this definition are positional, in which case it cannot be shared between siblings.
+	bool IsPositional() const { return positional; }
+
 private:
 	PropertyDictionary properties;
 	PropertyIdSet property_ids;
+	bool positional = false;
 };
 
 } // namespace Rml
@@ -0,0 +1,20 @@
+#include "ElementDefinitionCache.h"
+#include "ElementDefinition.h"
+
+namespace Rml {
+
+SharedPtr<const ElementDefinition> ElementDefinitionCache::GetOrCreate(const StyleSheetIndex::NodeList& nodes)
+{
+	const size_t hash = std::hash<StyleSheetIndex::NodeList>()(nodes);
+	Shard& shard = shards[hash % num_shards];
+
+	std::lock_guard<std::mutex> lock(shard.mutex);
+
+	SharedPtr<const ElementDefinition>& definition = shard.definitions[nodes];
+	if (!definition)
+		definition = MakeShared<const ElementDefinition>(nodes);
+
+	return definition;
+}
+
+} // namespace Rml
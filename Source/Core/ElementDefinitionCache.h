@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../../Include/RmlUi/Core/StyleSheetTypes.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
+
+namespace Rml {
+
+class ElementDefinition;
+
+/*
+    A cache of element definitions indexed by their list of applicable style sheet nodes, safe for concurrent use.
+
+    The cache is split into shards by the hash of the node list, each shard guarded by its own lock. Threads resolving definitions concurrently
+    thereby rarely contend, and the lock is only held for the lookup or insertion itself.
+*/
+class ElementDefinitionCache : NonCopyMoveable {
+public:
+	/// Returns the definition for the given list of nodes, creating it if it is not already cached.
+	/// @param[in] nodes The applicable nodes, sorted by specificity.
+	SharedPtr<const ElementDefinition> GetOrCreate(const StyleSheetIndex::NodeList& nodes);
+
+private:
+	static constexpr size_t num_shards = 16;
+
+	struct Shard {
+		std::mutex mutex;
+		UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>> definitions;
+	};
+
+	Shard shards[num_shards];
+};
+
+} // namespace Rml
@@ -477,6 +477,14 @@ void ElementDocument::UpdateLayout()
 {
 	// Note: Carefully consider when to call this function for performance reasons.
 	// Ideally, only called once per update loop.
+	if (!layout_dirty && !dirty_layout_boundaries.empty())
+	{
+		// Format only the contents of the dirty layout boundaries when possible. Like below, ignore any layout dirtied during formatting.
+		const bool success = UpdateLayoutBoundaries();
+		dirty_layout_boundaries.clear();
+		layout_dirty = !success;
+	}
+
 	if (layout_dirty)
 	{
 		RMLUI_ZoneScoped;
@@ -487,6 +495,7 @@ void ElementDocument::UpdateLayout()
 			containing_block = GetParentNode()->GetBox().GetSize();
 
 		LayoutEngine::FormatElement(this, containing_block);
+		dirty_layout_boundaries.clear();
 
 		// Ignore dirtied layout during document formatting. Layouting must not require re-iteration.
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
@@ -494,6 +503,38 @@ void ElementDocument::UpdateLayout()
 	}
 }
 
+bool ElementDocument::UpdateLayoutBoundaries()
+{
+	RMLUI_ZoneScoped;
+
+	// Move the list to a local copy, since formatting may dirty the layout boundaries again.
+	const Vector<ObserverPtr<Element>> boundaries = std::move(dirty_layout_boundaries);
+	dirty_layout_boundaries.clear();
+
+	for (const ObserverPtr<Element>& boundary : boundaries)
+	{
+		Element* element = boundary.get();
+		if (!element || element->GetOwnerDocument() != this || element->GetDisplay() == Style::Display::None)
+			continue;
+
+		// Skip boundaries nested within other dirty boundaries, they will be formatted together with their ancestor. Also skip boundaries that
+		// are not part of the layout, just like when formatting the document.
+		bool skip_boundary = false;
+		for (Element* ancestor = element->GetParentNode(); ancestor && ancestor != this && !skip_boundary; ancestor = ancestor->GetParentNode())
+		{
+			skip_boundary = (ancestor->GetDisplay() == Style::Display::None ||
+				std::any_of(boundaries.begin(), boundaries.end(), [ancestor](const ObserverPtr<Element>& other) { return other.get() == ancestor; }));
+		}
+		if (skip_boundary)
+			continue;
+
+		if (!LayoutEngine::FormatLayoutBoundary(element))
+			return false;
+	}
+
+	return true;
+}
+
 void ElementDocument::UpdatePosition()
 {
 	if (position_dirty)
@@ -541,6 +582,13 @@ void ElementDocument::DirtyPosition()
 }
 
 void ElementDocument::DirtyLayout()
+{
+	// Changes to the document itself may affect the layout of any element, so don't reuse any previous formatting results.
+	formatting_cache_generation += 1;
+	layout_dirty = true;
+}
+
+void ElementDocument::DirtyLayoutFromDescendant()
 {
 	layout_dirty = true;
 }
@@ -550,6 +598,18 @@ bool ElementDocument::IsLayoutDirty()
 	return layout_dirty;
 }
 
+void ElementDocument::DirtyLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(element && element != this);
+	if (layout_dirty)
+		return;
+
+	const auto it = std::find_if(dirty_layout_boundaries.begin(), dirty_layout_boundaries.end(),
+		[element](const ObserverPtr<Element>& boundary) { return boundary.get() == element; });
+	if (it == dirty_layout_boundaries.end())
+		dirty_layout_boundaries.push_back(element->GetObserverPtr());
+}
+
 void ElementDocument::DirtyVwAndVhProperties()
 {
 	GetStyle()->DirtyPropertiesWithUnitsRecursive(Unit::VW | Unit::VH);
@@ -5,6 +5,7 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Filter.h"
+#include "../../Include/RmlUi/Core/MeshUtilities.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "ElementStyle.h"
@@ -180,9 +181,18 @@ void ElementEffects::ReleaseEffects()
 
 	filters.clear();
 	backdrop_filters.clear();
+	ReleaseCache();
 }
 
-void ElementEffects::RenderEffects(RenderStage render_stage)
+void ElementEffects::ReleaseCache()
+{
+	cached_texture.Release();
+	cached_geometry = {};
+	cached_scissor_region = Rectanglei::MakeInvalid();
+	cached_clip_mask_list.clear();
+}
+
+void ElementEffects::RenderEffects(RenderStage render_stage, bool content_changed)
 {
 	InstanceEffects();
 	ReloadEffectsData();
@@ -246,6 +256,46 @@ void ElementEffects::RenderEffects(RenderStage render_stage)
 
 	if (render_stage == RenderStage::Enter)
 	{
+		render_from_cache = false;
+		capture_to_cache = false;
+
+		// The filtered result is rendered directly to the window from the cache, which is only done when it can be placed without a transform, and
+		// does not depend on the backdrop.
+		const bool cacheable = ((!filters.empty() || !mask_images.empty()) && backdrop_filters.empty() &&
+			render_manager->GetState().transform == Matrix4f::Identity());
+
+		if (!cacheable || content_changed)
+		{
+			ReleaseCache();
+		}
+		else
+		{
+			const RenderState initial_state = render_manager->GetState();
+			ApplyClippingRegion(PropertyId::Filter);
+
+			const RenderState& state = render_manager->GetState();
+			const Rectanglei window_region = Rectanglei::FromSize(render_manager->GetViewport());
+			const Vector2f offset = element->GetAbsoluteOffset(BoxArea::Border);
+
+			if (cached_texture.IsGenerated() && state.scissor_region == cached_scissor_region && state.clip_mask_list == cached_clip_mask_list &&
+				offset == cached_offset)
+			{
+				render_from_cache = true;
+			}
+			else
+			{
+				// Only save the result when all of it is inside the window, otherwise it may be clipped when the element moves.
+				ReleaseCache();
+				capture_to_cache = (state.scissor_region.Valid() && window_region.Contains(state.scissor_region.p0) &&
+					window_region.Contains(state.scissor_region.p1));
+			}
+
+			render_manager->SetState(initial_state);
+		}
+
+		if (render_from_cache)
+			return;
+
 		const LayerHandle backdrop_source_layer = render_manager->GetTopLayer();
 
 		if (!filters.empty() || !mask_images.empty())
@@ -286,6 +336,13 @@ void ElementEffects::RenderEffects(RenderStage render_stage)
 		{
 			ApplyClippingRegion(PropertyId::Filter);
 
+			if (render_from_cache)
+			{
+				cached_geometry.Render(Vector2f(0.f), cached_texture);
+				render_manager->SetScissorRegion(initial_scissor_region);
+				return;
+			}
+
 			CompiledFilter mask_image_filter;
 			FilterHandleList filter_handles;
 			filter_handles.reserve(filters.size() + (mask_images.empty() ? 0 : 1));
@@ -308,13 +365,65 @@ void ElementEffects::RenderEffects(RenderStage render_stage)
 				render_manager->PopLayer();
 			}
 
-			render_manager->CompositeLayers(render_manager->GetTopLayer(), render_manager->GetNextLayer(), BlendMode::Blend, filter_handles);
-			render_manager->PopLayer();
+			if (capture_to_cache)
+			{
+				// Apply the filters to a separate layer to be saved as a texture, then render the result from there.
+				render_manager->PushLayer();
+				render_manager->CompositeLayers(render_manager->GetNextLayer(), render_manager->GetTopLayer(), BlendMode::Replace, filter_handles);
+
+				// The layer is only available during this frame, thus the texture can not be regenerated later. Instead, the cache is released
+				// and the filters rendered again whenever the texture is no longer generated, such as after releasing all textures.
+				cached_texture = render_manager->MakeCallbackTexture(
+					[](const CallbackTextureInterface& texture_interface) { return texture_interface.SaveLayerAsTexture(); });
+
+				const RenderState state = render_manager->GetState();
+				const Vector2i texture_dimensions = Texture(cached_texture).GetDimensions();
+
+				render_manager->PopLayer();
+
+				if (texture_dimensions == state.scissor_region.Size())
+				{
+					render_manager->PopLayer();
+
+					Mesh mesh;
+					MeshUtilities::GenerateQuad(mesh, Vector2f(state.scissor_region.Position()), Vector2f(texture_dimensions),
+						ColourbPremultiplied(255));
+					cached_geometry = render_manager->MakeGeometry(std::move(mesh));
+					cached_scissor_region = state.scissor_region;
+					cached_clip_mask_list = state.clip_mask_list;
+					cached_offset = element->GetAbsoluteOffset(BoxArea::Border);
+					cached_geometry.Render(Vector2f(0.f), cached_texture);
+				}
+				else
+				{
+					// Saving layers is not supported by the render interface, render the result without the cache.
+					ReleaseCache();
+					render_manager->CompositeLayers(render_manager->GetTopLayer(), render_manager->GetNextLayer(), BlendMode::Blend, filter_handles);
+					render_manager->PopLayer();
+				}
+			}
+			else
+			{
+				render_manager->CompositeLayers(render_manager->GetTopLayer(), render_manager->GetNextLayer(), BlendMode::Blend, filter_handles);
+				render_manager->PopLayer();
+			}
+
 			render_manager->SetScissorRegion(initial_scissor_region);
 		}
 	}
 }
 
+bool ElementEffects::ExtendInkOverflow(Rectanglef& region) const
+{
+	if (effects_dirty)
+		return false;
+
+	for (const FilterEntry& filter : filters)
+		filter.filter->ExtendInkOverflow(element, region);
+
+	return true;
+}
+
 void ElementEffects::DirtyEffects()
 {
 	effects_dirty = true;
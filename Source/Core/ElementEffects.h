@@ -1,6 +1,9 @@
 #pragma once
 
+#include "../../Include/RmlUi/Core/CallbackTexture.h"
 #include "../../Include/RmlUi/Core/CompiledFilterShader.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
@@ -22,7 +25,15 @@ public:
 
 	void InstanceEffects();
 
-	void RenderEffects(RenderStage render_stage);
+	// Renders the effects of the given stage. The content changed flag is only used when entering, if not set the filtered result from the
+	// previous frame may be reused.
+	void RenderEffects(RenderStage render_stage, bool content_changed = true);
+
+	// Returns true if the filtered result is rendered from the cache, the element's content and stacking context need not be rendered then.
+	bool IsRenderingCachedContent() const { return render_from_cache; }
+
+	// Extends the region by the ink overflow of the element's filters. Returns false if the filters are not yet instanced.
+	bool ExtendInkOverflow(Rectanglef& region) const;
 
 	// Mark effects as dirty and force them to reset themselves.
 	void DirtyEffects();
@@ -34,6 +45,8 @@ private:
 	void ReloadEffectsData();
 	// Releases all existing effects and their element data.
 	void ReleaseEffects();
+	// Releases the filtered result saved from a previous frame.
+	void ReleaseCache();
 
 	struct DecoratorEntry {
 		SharedPtr<const Decorator> decorator;
@@ -60,6 +73,16 @@ private:
 	bool effects_dirty = false;
 	// If set, element data of all decorators need to be regenerated.
 	bool effects_data_dirty = false;
+
+	// The filtered and masked result of the element and its stacking context, saved for reuse when the content is unchanged between frames.
+	CallbackTexture cached_texture;
+	Geometry cached_geometry;
+	Rectanglei cached_scissor_region;
+	ClipMaskGeometryList cached_clip_mask_list;
+	Vector2f cached_offset;
+	// Set during rendering when the cache is used this frame, or when the result should be saved to the cache.
+	bool render_from_cache = false;
+	bool capture_to_cache = false;
 };
 
 } // namespace Rml
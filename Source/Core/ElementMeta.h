@@ -10,6 +10,8 @@
 #include "ElementEffects.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "HitTestGrid.h"
+#include "Layout/FormattingCache.h"
 #include "Pool.h"
 
 namespace Rml {
@@ -24,6 +26,10 @@ struct ElementMeta {
 	ElementEffects effects;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+	// Properties changed when computing values ahead of the update, to be passed on to OnPropertyChange during the update.
+	PropertyIdSet precomputed_property_changes;
+	FormattingCache formatting_cache;
+	HitTestGrid hit_test_grid;
 };
 
 struct ElementMetaPool {
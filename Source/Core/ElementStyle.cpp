@@ -21,6 +21,7 @@
 #include "PropertiesIterator.h"
 #include "PropertyShorthandDefinition.h"
 #include <algorithm>
+#include <mutex>
 #include <optional>
 
 namespace Rml {
@@ -43,6 +44,7 @@ static PseudoClassState operator&(PseudoClassState lhs, PseudoClassState rhs)
 ElementStyle::ElementStyle(Element* _element)
 {
 	element = _element;
+	tag = AtomTable::GetOrInsert(element->GetTagName());
 }
 
 const Property* ElementStyle::GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition)
@@ -446,7 +448,7 @@ void ElementStyle::TransitionPropertyChanges(const PropertySources& sources, Pro
 	}
 }
 
-void ElementStyle::UpdateDefinition()
+bool ElementStyle::UpdateDefinition(bool allow_transitions)
 {
 	RMLUI_ZoneScoped;
 
@@ -460,6 +462,9 @@ void ElementStyle::UpdateDefinition()
 	// Switch the property definitions if the definition has changed.
 	if (new_definition != definition)
 	{
+		if (!allow_transitions && definition && new_definition && GetLocalProperty(PropertyId::Transition, inline_properties, new_definition.get()))
+			return false;
+
 		PropertyIdSet changed_properties;
 		UnorderedSet<String> changed_variables;
 		UnorderedSet<ShorthandId> changed_shorthands;
@@ -506,7 +511,10 @@ void ElementStyle::UpdateDefinition()
 		DirtyProperties(changed_properties);
 		dirty_variables.insert(std::make_move_iterator(changed_variables.begin()), std::make_move_iterator(changed_variables.end()));
 		dirty_var_shorthands.insert(changed_shorthands.begin(), changed_shorthands.end());
+		element->DirtyUpdate();
 	}
+
+	return true;
 }
 
 bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
@@ -515,13 +523,13 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 
 	if (activate)
 	{
-		PseudoClassState& state = pseudo_classes[pseudo_class];
+		PseudoClassState& state = pseudo_classes[AtomTable::GetOrInsert(pseudo_class)];
 		changed = (state == PseudoClassState::Clear);
 		state = (state | (override_class ? PseudoClassState::Override : PseudoClassState::Set));
 	}
 	else
 	{
-		auto it = pseudo_classes.find(pseudo_class);
+		auto it = pseudo_classes.find(AtomTable::Find(pseudo_class));
 		if (it != pseudo_classes.end())
 		{
 			PseudoClassState& state = it->second;
@@ -538,6 +546,11 @@ bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, boo
 }
 
 bool ElementStyle::IsPseudoClassSet(const String& pseudo_class) const
+{
+	return IsPseudoClassSet(AtomTable::Find(pseudo_class));
+}
+
+bool ElementStyle::IsPseudoClassSet(Atom pseudo_class) const
 {
 	return (pseudo_classes.count(pseudo_class) == 1);
 }
@@ -549,14 +562,18 @@ const PseudoClassMap& ElementStyle::GetActivePseudoClasses() const
 
 bool ElementStyle::SetClass(const String& class_name, bool activate)
 {
-	const auto class_location = std::find(classes.begin(), classes.end(), class_name);
+	if (class_name.empty())
+		return false;
+
+	const Atom class_atom = (activate ? AtomTable::GetOrInsert(class_name) : AtomTable::Find(class_name));
+	const auto class_location = std::find(classes.begin(), classes.end(), class_atom);
 
 	bool changed = false;
 	if (activate)
 	{
 		if (class_location == classes.end())
 		{
-			classes.push_back(class_name);
+			classes.push_back(class_atom);
 			changed = true;
 		}
 	}
@@ -569,18 +586,33 @@ bool ElementStyle::SetClass(const String& class_name, bool activate)
 		}
 	}
 
+	if (changed)
+		DirtyAncestorFilter();
+
 	return changed;
 }
 
 bool ElementStyle::IsClassSet(const String& class_name) const
 {
-	return std::find(classes.begin(), classes.end(), class_name) != classes.end();
+	return IsClassSet(AtomTable::Find(class_name));
+}
+
+bool ElementStyle::IsClassSet(Atom class_name) const
+{
+	return class_name != Atom::Empty && std::find(classes.begin(), classes.end(), class_name) != classes.end();
 }
 
 void ElementStyle::SetClassNames(const String& class_names)
 {
+	StringList class_list;
+	StringUtilities::ExpandString(class_list, class_names, ' ');
+
 	classes.clear();
-	StringUtilities::ExpandString(classes, class_names, ' ');
+	classes.reserve(class_list.size());
+	for (const String& class_name : class_list)
+		classes.push_back(AtomTable::GetOrInsert(class_name));
+
+	DirtyAncestorFilter();
 }
 
 String ElementStyle::GetClassNames() const
@@ -592,17 +624,119 @@ String ElementStyle::GetClassNames() const
 		{
 			class_names += " ";
 		}
-		class_names += classes[i];
+		class_names += AtomTable::GetName(classes[i]);
 	}
 
 	return class_names;
 }
 
-const StringList& ElementStyle::GetClassNameList() const
+const AtomList& ElementStyle::GetClassNameList() const
 {
 	return classes;
 }
 
+void ElementStyle::SetId(const String& new_id)
+{
+	const Atom new_id_atom = AtomTable::GetOrInsert(new_id);
+	if (new_id_atom != id)
+	{
+		id = new_id_atom;
+		DirtyAncestorFilter();
+	}
+}
+
+const AncestorFilter& ElementStyle::GetAncestorFilter()
+{
+	// Find the newest change to the names of our ancestors. Ancestors are only read from, so that the filters of separate subtrees can be built
+	// concurrently.
+	int newest_ancestor_stamp = 0;
+	for (Element* ancestor = element->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+		newest_ancestor_stamp = Math::Max(newest_ancestor_stamp, ancestor->GetStyle()->names_stamp);
+
+	const int newest_stamp = Math::Max(newest_ancestor_stamp, names_stamp);
+	if (ancestor_filter_stamp >= newest_stamp)
+		return ancestor_filter;
+
+	ancestor_filter = {};
+	for (Element* ancestor = element->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+	{
+		const ElementStyle* ancestor_style = ancestor->GetStyle();
+		ancestor_filter.Insert(ancestor_style->tag);
+		ancestor_filter.Insert(ancestor_style->id);
+		for (Atom class_name : ancestor_style->classes)
+			ancestor_filter.Insert(class_name);
+
+		// The parent's filter is usually valid when styles are updated from the top down, then we can reuse it. It is valid as long as it is not
+		// older than the changes to the parent and its ancestors, which are all covered by our newest ancestor stamp.
+		if (ancestor == element->GetParentNode() && ancestor_style->ancestor_filter_stamp >= newest_ancestor_stamp)
+		{
+			ancestor_filter.Insert(ancestor_style->ancestor_filter);
+			break;
+		}
+	}
+	ancestor_filter_stamp = newest_stamp;
+
+	return ancestor_filter;
+}
+
+Element* ElementStyle::GetStyleSharingCandidate()
+{
+	Element* parent = element->parent;
+	if (!parent)
+		return nullptr;
+
+	// The index of the element most recently looking up its preceding sibling on this thread, used to avoid searching when siblings are updated in
+	// order. It is only used as a guess, thus it is safe even if it refers to a different parent.
+	static thread_local int hint = -1;
+
+	const OwnedElementList& siblings = parent->children;
+	const int num_siblings = (int)siblings.size();
+
+	int index = -1;
+	if (hint >= 0 && hint < num_siblings && siblings[hint].get() == element)
+		index = hint;
+	else if (hint + 1 >= 0 && hint + 1 < num_siblings && siblings[hint + 1].get() == element)
+		index = hint + 1;
+	else
+	{
+		auto it = std::find_if(siblings.begin(), siblings.end(), [this](const ElementPtr& sibling) { return sibling.get() == element; });
+		if (it == siblings.end())
+			return nullptr;
+		index = int(it - siblings.begin());
+	}
+
+	hint = index;
+	if (index == 0)
+		return nullptr;
+
+	Element* sibling = siblings[index - 1].get();
+	if (sibling->dirty_definition)
+		return nullptr;
+
+	return sibling;
+}
+
+bool ElementStyle::CopyComputedValuesFromSibling(Style::ComputedValues& values)
+{
+	if (!inline_properties.Empty())
+		return false;
+
+	Element* sibling = GetStyleSharingCandidate();
+	if (!sibling || sibling->computed_values_are_default_initialized)
+		return false;
+
+	// The sibling must be fully up to date and styled by the same definition. Since the parent is shared too, this implies that all inputs to
+	// the computed values are equal.
+	const ElementStyle& sibling_style = *sibling->GetStyle();
+	if (sibling_style.definition != definition || !sibling_style.inline_properties.Empty() || sibling_style.AnyPropertiesDirty())
+		return false;
+
+	const Style::ComputedValues& sibling_values = sibling->GetComputedValues();
+	values.CopyNonInherited(sibling_values);
+	values.CopyInherited(sibling_values);
+	return true;
+}
+
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 {
 	Property new_property = property;
@@ -621,12 +755,14 @@ void ElementStyle::SetCustomProperty(const String& name, const Property& propert
 {
 	inline_properties.SetCustomProperty(name, property);
 	dirty_variables.insert(name);
+	element->DirtyUpdate();
 }
 
 void ElementStyle::SetVarShorthand(ShorthandId id, const Property& property)
 {
 	inline_properties.SetVarShorthand(id, property);
 	dirty_var_shorthands.insert(id);
+	element->DirtyUpdate();
 }
 
 void ElementStyle::RemoveProperty(PropertyId id)
@@ -641,13 +777,19 @@ void ElementStyle::RemoveProperty(PropertyId id)
 void ElementStyle::RemoveCustomProperty(const String& name)
 {
 	if (inline_properties.RemoveCustomProperty(name))
+	{
 		dirty_variables.insert(name);
+		element->DirtyUpdate();
+	}
 }
 
 void ElementStyle::RemoveVarShorthand(ShorthandId id)
 {
 	if (inline_properties.RemoveVarShorthand(id))
+	{
 		dirty_var_shorthands.insert(id);
+		element->DirtyUpdate();
+	}
 }
 
 const Property* ElementStyle::GetProperty(PropertyId id) const
@@ -804,6 +946,7 @@ float ElementStyle::ResolveRelativeLength(NumericValue value, RelativeTarget rel
 void ElementStyle::DirtyInheritedProperties()
 {
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyPropertiesWithUnits(Units units)
@@ -868,6 +1011,7 @@ void ElementStyle::Shutdown()
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->DirtyUpdate();
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values,
@@ -895,109 +1039,124 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 	const float font_size_before = values.font_size();
 	const Style::LineHeight line_height_before = values.line_height();
 
-	// The next flag is just a small optimization, if the element was just created we don't need to copy all the default values.
-	if (!values_are_default_initialized)
+	// Freshly created elements, such as repeated rows, can copy the computed values of an identically styled preceding sibling. The dirty
+	// properties are extended just like when computing the values from scratch.
+	if (values_are_default_initialized && CopyComputedValuesFromSibling(values))
 	{
-		// This needs to be done in case some properties were removed and thus not in our local style anymore.
-		// If we skipped this, the old dirty value would be unmodified, instead, now it is set to its default value.
-		// Strictly speaking, we only really need to do this for the dirty, non-inherited values. However, in most
-		// cases it seems simply assigning all non-inherited values is faster than iterating the dirty properties.
-		values.CopyNonInherited(DefaultComputedValues());
+		if (font_size_before != values.font_size())
+			dirty_properties.Insert(PropertyId::LineHeight);
+		if (line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value)
+			dirty_properties.Insert(PropertyId::VerticalAlign);
 	}
+	else
+	{
+		// The next flag is just a small optimization, if the element was just created we don't need to copy all the default values.
+		if (!values_are_default_initialized)
+		{
+			// This needs to be done in case some properties were removed and thus not in our local style anymore.
+			// If we skipped this, the old dirty value would be unmodified, instead, now it is set to its default value.
+			// Strictly speaking, we only really need to do this for the dirty, non-inherited values. However, in most
+			// cases it seems simply assigning all non-inherited values is faster than iterating the dirty properties.
+			values.CopyNonInherited(DefaultComputedValues());
+		}
 
-	if (parent_values)
-		values.CopyInherited(*parent_values);
-	else if (!values_are_default_initialized)
-		values.CopyInherited(DefaultComputedValues());
+		if (parent_values)
+			values.CopyInherited(*parent_values);
+		else if (!values_are_default_initialized)
+			values.CopyInherited(DefaultComputedValues());
 
-	SmallUnorderedSet<String> variable_dependencies;
-	bool dirty_em_properties = false;
+		SmallUnorderedSet<String> variable_dependencies;
+		bool dirty_em_properties = false;
 
-	// Always do font-size first if dirty, because of em-relative values
-	if (dirty_properties.Contains(PropertyId::FontSize))
-	{
-		if (const Property* property = GetLocalProperty(PropertyId::FontSize))
+		// Always do font-size first if dirty, because of em-relative values
+		if (dirty_properties.Contains(PropertyId::FontSize))
 		{
-			variable_dependencies.clear();
-			property = ResolveVariables(PropertyId::FontSize, property, variable_dependencies, property_storage);
-			if (property)
-				values.font_size(ComputeFontsize(property->GetNumericValue(), values, parent_values, document_values, dp_ratio, vp_dimensions));
-		}
-		else if (parent_values)
-			values.font_size(parent_values->font_size());
+			if (const Property* property = GetLocalProperty(PropertyId::FontSize))
+			{
+				variable_dependencies.clear();
+				property = ResolveVariables(PropertyId::FontSize, property, variable_dependencies, property_storage);
+				if (property)
+					values.font_size(ComputeFontsize(property->GetNumericValue(), values, parent_values, document_values, dp_ratio, vp_dimensions));
+			}
+			else if (parent_values)
+				values.font_size(parent_values->font_size());
 
-		if (font_size_before != values.font_size())
+			if (font_size_before != values.font_size())
+			{
+				dirty_em_properties = true;
+				dirty_properties.Insert(PropertyId::LineHeight);
+			}
+		}
+		else
 		{
-			dirty_em_properties = true;
-			dirty_properties.Insert(PropertyId::LineHeight);
+			values.font_size(font_size_before);
 		}
-	}
-	else
-	{
-		values.font_size(font_size_before);
-	}
 
-	const float font_size = values.font_size();
-	const float document_font_size = (document_values ? document_values->font_size() : DefaultComputedValues().font_size());
+		const float font_size = values.font_size();
+		const float document_font_size = (document_values ? document_values->font_size() : DefaultComputedValues().font_size());
 
-	// Since vertical-align depends on line-height we compute this before iteration
-	if (dirty_properties.Contains(PropertyId::LineHeight))
-	{
-		if (const Property* property = GetLocalProperty(PropertyId::LineHeight))
+		// Since vertical-align depends on line-height we compute this before iteration
+		if (dirty_properties.Contains(PropertyId::LineHeight))
 		{
-			variable_dependencies.clear();
-			property = ResolveVariables(PropertyId::LineHeight, property, variable_dependencies, property_storage);
-			if (property)
-				values.line_height(ComputeLineHeight(property, font_size, document_font_size, dp_ratio, vp_dimensions));
+			if (const Property* property = GetLocalProperty(PropertyId::LineHeight))
+			{
+				variable_dependencies.clear();
+				property = ResolveVariables(PropertyId::LineHeight, property, variable_dependencies, property_storage);
+				if (property)
+					values.line_height(ComputeLineHeight(property, font_size, document_font_size, dp_ratio, vp_dimensions));
+			}
+			else if (parent_values)
+			{
+				// Line height has a special inheritance case for numbers/percent: they inherit them directly instead of computed length, but for lengths,
+				// they inherit the length. See CSS specs for details. Percent is already converted to number.
+				if (parent_values->line_height().inherit_type == Style::LineHeight::Number)
+					values.line_height(Style::LineHeight(font_size * parent_values->line_height().inherit_value, Style::LineHeight::Number,
+						parent_values->line_height().inherit_value));
+				else
+					values.line_height(parent_values->line_height());
+			}
+
+			if (line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value)
+				dirty_properties.Insert(PropertyId::VerticalAlign);
 		}
-		else if (parent_values)
+		else
 		{
-			// Line height has a special inheritance case for numbers/percent: they inherit them directly instead of computed length, but for lengths,
-			// they inherit the length. See CSS specs for details. Percent is already converted to number.
-			if (parent_values->line_height().inherit_type == Style::LineHeight::Number)
-				values.line_height(Style::LineHeight(font_size * parent_values->line_height().inherit_value, Style::LineHeight::Number,
-					parent_values->line_height().inherit_value));
-			else
-				values.line_height(parent_values->line_height());
+			values.line_height(line_height_before);
 		}
 
-		if (line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value)
-			dirty_properties.Insert(PropertyId::VerticalAlign);
-	}
-	else
-	{
-		values.line_height(line_height_before);
-	}
+		bool dirty_font_face_handle = false;
 
-	bool dirty_font_face_handle = false;
+		for (auto it = Iterate(); !it.AtEnd(); ++it)
+		{
+			variable_dependencies.clear();
+			auto id_property_pair = *it;
+			const PropertyId id = id_property_pair.first;
+			const Property* property = ResolveVariables(id, &id_property_pair.second, variable_dependencies, property_storage);
+			if (!property)
+				continue;
 
-	for (auto it = Iterate(); !it.AtEnd(); ++it)
-	{
-		variable_dependencies.clear();
-		auto id_property_pair = *it;
-		const PropertyId id = id_property_pair.first;
-		const Property* property = ResolveVariables(id, &id_property_pair.second, variable_dependencies, property_storage);
-		if (!property)
-			continue;
+			for (const String& variable_name : variable_dependencies)
+			{
+				if (dirty_variables.count(variable_name) != 0)
+					dirty_properties.Insert(id);
+			}
 
-		for (const String& variable_name : variable_dependencies)
-		{
-			if (dirty_variables.count(variable_name) != 0)
+			if (dirty_em_properties && property->unit == Unit::EM)
 				dirty_properties.Insert(id);
-		}
-
-		if (dirty_em_properties && property->unit == Unit::EM)
-			dirty_properties.Insert(id);
 
-		ComputeValue(values, dp_ratio, vp_dimensions, font_size, document_font_size, dirty_font_face_handle, id, property);
-	}
+			ComputeValue(values, dp_ratio, vp_dimensions, font_size, document_font_size, dirty_font_face_handle, id, property);
+		}
 
-	// The font-face handle is nulled when local font properties are set. In that case we need to retrieve a new handle.
-	if (dirty_font_face_handle)
-	{
-		RMLUI_ZoneScopedN("FontFaceHandle");
-		values.font_face_handle(
-			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
+		// The font-face handle is nulled when local font properties are set. In that case we need to retrieve a new handle.
+		if (dirty_font_face_handle)
+		{
+			RMLUI_ZoneScopedN("FontFaceHandle");
+			// The font engine need not be thread-safe, while values may be computed on multiple threads.
+			static std::mutex font_engine_mutex;
+			std::lock_guard<std::mutex> lock(font_engine_mutex);
+			values.font_face_handle(
+				GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
+		}
 	}
 
 	// Next, pass inheritable dirty properties onto our children
@@ -1016,6 +1175,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			auto child = element->GetChild(i);
 			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
 			child->GetStyle()->dirty_variables.insert(dirty_variables.begin(), dirty_variables.end());
+			child->DirtyUpdate();
 		}
 	}
 
@@ -1039,6 +1199,7 @@ ElementStyle::DirtyPropertiesRef ElementStyle::GetDirtyPropertiesRef()
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
 	dirty_properties |= properties;
+	element->DirtyUpdate();
 }
 
 const Property* ElementStyle::ResolveVariables(PropertyId id, const Property* property, SmallUnorderedSet<String>& variable_dependencies,
@@ -4,6 +4,8 @@
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
+#include "Atom.h"
 #include <optional>
 
 namespace Rml {
@@ -14,7 +16,7 @@ class AllPropertiesIterator;
 enum class RelativeTarget;
 
 enum class PseudoClassState : uint8_t { Clear = 0, Set = 1, Override = 2 };
-using PseudoClassMap = SmallUnorderedMap<String, PseudoClassState>;
+using PseudoClassMap = SmallUnorderedMap<Atom, PseudoClassState>;
 
 /**
     Manages an element's style and property information.
@@ -27,7 +29,9 @@ public:
 	ElementStyle(Element* element);
 
 	/// Update this definition if required
-	void UpdateDefinition();
+	/// @param[in] allow_transitions False to leave the definition unchanged if the change would start any transitions.
+	/// @return False if the definition was left unchanged due to transitions.
+	bool UpdateDefinition(bool allow_transitions = true);
 
 	/// Sets or removes a pseudo-class on the element.
 	/// @param[in] pseudo_class The pseudo class to activate or deactivate.
@@ -40,6 +44,8 @@ public:
 	/// @param[in] pseudo_class The name of the pseudo-class to check for.
 	/// @return True if the pseudo-class is set on the element, false if not.
 	bool IsPseudoClassSet(const String& pseudo_class) const;
+	/// Checks if a specific pseudo-class has been set on the element.
+	bool IsPseudoClassSet(Atom pseudo_class) const;
 	/// Gets a list of the current active pseudo classes
 	const PseudoClassMap& GetActivePseudoClasses() const;
 
@@ -52,6 +58,8 @@ public:
 	/// @param[in] class_name The name of the class to check for.
 	/// @return True if the class is set on the element, false otherwise.
 	bool IsClassSet(const String& class_name) const;
+	/// Checks if a class is set on the element.
+	bool IsClassSet(Atom class_name) const;
 	/// Specifies the entire list of classes for this element. This will replace any others specified.
 	/// @param[in] class_names The list of class names to set on the style, separated by spaces.
 	void SetClassNames(const String& class_names);
@@ -59,7 +67,23 @@ public:
 	/// @return A string containing all the classes on the element, separated by spaces.
 	String GetClassNames() const;
 	/// Return the active class list.
-	const StringList& GetClassNameList() const;
+	const AtomList& GetClassNameList() const;
+
+	/// Sets the id of the element, used for selector matching.
+	void SetId(const String& id);
+	/// Returns the atom of the element's id.
+	Atom GetIdAtom() const { return id; }
+	/// Returns the atom of the element's tag name.
+	Atom GetTagAtom() const { return tag; }
+	/// Returns a filter of the tag, id, and class names of all the element's ancestors, rebuilding it if it has been invalidated.
+	const AncestorFilter& GetAncestorFilter();
+	/// Invalidates the ancestor filters of the element and its descendants, such as when the element has been moved in the hierarchy.
+	void DirtyAncestorFilter() { names_stamp = AncestorFilter::NewStamp(); }
+
+	/// Returns the current definition of the element.
+	const SharedPtr<const ElementDefinition>& GetDefinition() const { return definition; }
+	/// Returns the element's preceding sibling if its definition is up to date, making it a candidate for sharing its style with this element.
+	Element* GetStyleSharingCandidate();
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] id The ID  of the new property.
@@ -178,6 +202,9 @@ private:
 		Element* element = nullptr;
 	};
 
+	// Copies the computed values of our preceding sibling if they are guaranteed to equal our own, returns false if not possible.
+	bool CopyComputedValuesFromSibling(Style::ComputedValues& values);
+
 	PropertySources GetPropertySources() const;
 	DirtyPropertiesRef GetDirtyPropertiesRef();
 
@@ -218,8 +245,16 @@ private:
 	// Element these properties belong to
 	Element* element;
 
+	// The tag name and id of the element.
+	Atom tag;
+	Atom id = Atom::Empty;
 	// The list of classes applicable to this object.
-	StringList classes;
+	AtomList classes;
+	// Stamped whenever our names or our position in the hierarchy changes.
+	int names_stamp = 0;
+	// The names of all our ancestors, valid as long as neither we nor any ancestor has been stamped after this filter's stamp.
+	AncestorFilter ancestor_filter;
+	int ancestor_filter_stamp = -1;
 	// This element's current pseudo-classes.
 	PseudoClassMap pseudo_classes;
 
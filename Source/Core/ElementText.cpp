@@ -100,7 +100,8 @@ void LogMissingFontFace(Element* element)
 RMLUI_RTTI_Define(ElementText)
 
 ElementText::ElementText(const String& tag) :
-	Element(tag), colour(255, 255, 255), opacity(1), font_handle_version(0), geometry_dirty(true), dirty_layout_on_change(true),
+	Element(tag), colour(255, 255, 255), opacity(1), font_handle_version(0), geometry_dirty(true), geometry_colour_dirty(false),
+	dirty_layout_on_change(true),
 	generated_decoration(Style::TextDecoration::None), decoration_property(Style::TextDecoration::None), font_effects_dirty(true),
 	font_effects_handle(0)
 {}
@@ -112,6 +113,7 @@ void ElementText::SetText(const String& _text)
 	if (text != _text)
 	{
 		text = _text;
+		DirtyRender();
 
 		if (dirty_layout_on_change)
 			DirtyLayout();
@@ -145,9 +147,11 @@ void ElementText::OnRender()
 		geometry_dirty = true;
 	}
 
-	// Regenerate the geometry if the colour or font configuration has altered.
+	// Regenerate the geometry if the font configuration has altered, or just recolour it if only the colour has altered.
 	if (geometry_dirty)
 		GenerateGeometry(render_manager, font_face_handle);
+	else if (geometry_colour_dirty)
+		UpdateGeometryColour();
 
 	// Regenerate text decoration if necessary.
 	if (decoration_property != generated_decoration)
@@ -384,7 +388,15 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 		{
 			opacity = new_opacity;
 			font_effects_dirty = true;
-			geometry_dirty = true;
+		}
+
+		// Geometry generated from glyphs only needs to be recoloured, otherwise it must be generated again.
+		if (colour_changed || opacity_changed)
+		{
+			if (glyphs.empty())
+				geometry_dirty = true;
+			else
+				geometry_colour_dirty = true;
 		}
 	}
 
@@ -426,9 +438,6 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	}
 	else if (colour_changed)
 	{
-		// Force the geometry to be regenerated.
-		geometry_dirty = true;
-
 		// Re-colour the decoration geometry.
 		if (decoration)
 		{
@@ -488,19 +497,40 @@ void ElementText::GenerateGeometry(RenderManager& render_manager, const FontFace
 	const auto& computed = GetComputedValues();
 	const TextShapingContext text_shaping_context{computed.language(), computed.direction(), computed.font_kerning(), computed.letter_spacing()};
 
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
 	TexturedMeshList mesh_list;
 	mesh_list.reserve(geometry.size());
 
-	for (Line& line : lines)
-	{
-		line.width = GetFontEngineInterface()->GenerateString(render_manager, font_face_handle, font_effects_handle, line.text, line.position, colour,
+	for (TexturedGlyphs& glyphs_entry : glyphs)
+		glyphs_entry.glyphs.clear();
+
+	// Prefer generating glyphs when supported by the font engine, so that later colour changes can be applied without generating the strings.
+	bool use_glyphs = true;
+	const auto generate_string = [&](Line& line, StringView string) {
+		if (use_glyphs)
+		{
+			line.width = font_engine_interface->GenerateStringGlyphs(render_manager, font_face_handle, font_effects_handle, string, line.position,
+				text_shaping_context, glyphs);
+			if (line.width >= 0)
+				return;
+
+			use_glyphs = false;
+			glyphs.clear();
+		}
+
+		line.width = font_engine_interface->GenerateString(render_manager, font_face_handle, font_effects_handle, string, line.position, colour,
 			opacity, text_shaping_context, mesh_list);
-	}
+	};
+
+	for (Line& line : lines)
+		generate_string(line, line.text);
 
 	const auto text_overflows_on_line = [&](const Line& line) { return line.position.x + line.width > text_overflow.overflow_width; };
 	if (text_overflow.enabled && std::any_of(lines.begin(), lines.end(), text_overflows_on_line))
 	{
 		mesh_list.clear();
+		for (TexturedGlyphs& glyphs_entry : glyphs)
+			glyphs_entry.glyphs.clear();
 
 		for (Line& line : lines)
 		{
@@ -520,12 +550,21 @@ void ElementText::GenerateGeometry(RenderManager& render_manager, const FontFace
 				abbreviated_text.reserve(line.text.size() + text_overflow.overflow_text.size());
 				abbreviated_text.assign(line.text.c_str(), view.get());
 				abbreviated_text.append(text_overflow.overflow_text);
-				line.width = GetFontEngineInterface()->GetStringWidth(font_face_handle, abbreviated_text, text_shaping_context);
+				line.width = font_engine_interface->GetStringWidth(font_face_handle, abbreviated_text, text_shaping_context);
 				text_submit_view = abbreviated_text;
 			}
 
-			line.width = GetFontEngineInterface()->GenerateString(render_manager, font_face_handle, font_effects_handle, text_submit_view,
-				line.position, colour, opacity, text_shaping_context, mesh_list);
+			generate_string(line, text_submit_view);
+		}
+	}
+
+	if (use_glyphs)
+	{
+		mesh_list.resize(glyphs.size());
+		for (size_t i = 0; i < glyphs.size(); i++)
+		{
+			MeshUtilities::GenerateGlyphs(mesh_list[i].mesh, glyphs[i], colour, opacity);
+			mesh_list[i].texture = glyphs[i].texture;
 		}
 	}
 
@@ -542,6 +581,26 @@ void ElementText::GenerateGeometry(RenderManager& render_manager, const FontFace
 
 	generated_decoration = Style::TextDecoration::None;
 	geometry_dirty = false;
+	geometry_colour_dirty = false;
+}
+
+void ElementText::UpdateGeometryColour()
+{
+	RMLUI_ZoneScopedC(0xD2691E);
+	RMLUI_ASSERT(glyphs.size() == geometry.size());
+
+	for (size_t i = 0; i < geometry.size() && i < glyphs.size(); i++)
+	{
+		if (!geometry[i].geometry)
+			continue;
+
+		// Only the vertex colours change, thus the compiled geometry can be updated in place rather than compiled again.
+		Mesh mesh = geometry[i].geometry.GetMesh();
+		MeshUtilities::SetGlyphColours(mesh, glyphs[i], colour, opacity);
+		geometry[i].geometry.UpdateMesh(std::move(mesh));
+	}
+
+	geometry_colour_dirty = false;
 }
 
 void ElementText::GenerateDecoration(Mesh& mesh, const FontFaceHandle font_face_handle)
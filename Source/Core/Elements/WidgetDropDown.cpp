@@ -280,6 +280,7 @@ void WidgetDropDown::OnValueChange(const String& value)
 	parent_element->DispatchEvent(EventId::Change, parameters);
 
 	value_rml_dirty = true;
+	parent_element->DirtyUpdate();
 	value_changed_since_last_box_format = true;
 }
 
@@ -316,6 +317,7 @@ void WidgetDropDown::SetSelection(Element* select_option, bool force)
 	}
 
 	value_rml_dirty = true;
+	parent_element->DirtyUpdate();
 }
 
 void WidgetDropDown::SeekSelection(bool seek_forward)
@@ -433,6 +435,7 @@ void WidgetDropDown::OnChildAdd(Element* element)
 		SetSelection(element, true);
 
 	selection_dirty = true;
+	parent_element->DirtyUpdate();
 	box_layout_dirty = true;
 }
 
@@ -447,6 +450,7 @@ void WidgetDropDown::OnChildRemove(Element* element)
 		SetSelection(nullptr);
 
 	selection_dirty = true;
+	parent_element->DirtyUpdate();
 	box_layout_dirty = true;
 }
 
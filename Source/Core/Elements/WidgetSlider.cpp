@@ -127,6 +127,9 @@ void WidgetSlider::Update()
 				ctx->RequestNextUpdate(arrow_timers[i]);
 		}
 	}
+
+	// Keep receiving updates while the arrows are held down.
+	parent->DirtyUpdate();
 }
 
 void WidgetSlider::SetBarPosition(float _bar_position)
@@ -394,12 +397,14 @@ void WidgetSlider::ProcessEvent(Event& event)
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			SetBarPosition(OnLineDecrement());
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			SetBarPosition(OnLineIncrement());
 		}
 	}
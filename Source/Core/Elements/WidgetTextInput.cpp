@@ -440,6 +440,7 @@ void WidgetTextInput::OnUpdate()
 		{
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
+			parent->DirtyRender();
 		}
 
 		if (parent->IsVisible(true))
@@ -447,6 +448,9 @@ void WidgetTextInput::OnUpdate()
 			if (Context* ctx = parent->GetContext())
 				ctx->RequestNextUpdate(cursor_timer);
 		}
+
+		// Keep receiving updates while the cursor is blinking.
+		parent->DirtyUpdate();
 	}
 }
 
@@ -1163,6 +1167,7 @@ void WidgetTextInput::ShowCursor(bool show)
 		cursor_visible = true;
 		cursor_timer = CURSOR_BLINK_TIME;
 		last_update_time = GetSystemInterface()->GetElapsedTime();
+		parent->DirtyUpdate();
 	}
 	else
 	{
@@ -1171,6 +1176,7 @@ void WidgetTextInput::ShowCursor(bool show)
 		last_update_time = 0;
 	}
 
+	parent->DirtyRender();
 	SetKeyboardActive(show);
 }
 
@@ -1248,6 +1254,8 @@ Vector2f WidgetTextInput::FormatText(float height_constraint)
 
 	const FontMetrics& font_metrics = GetFontEngineInterface()->GetFontMetrics(font_handle);
 
+	parent->DirtyRender();
+
 	// Clear the old lines, and all the lines in the text elements.
 	lines.clear();
 	text_element->ClearLines();
@@ -1455,6 +1463,8 @@ void WidgetTextInput::UpdateCursorPosition(bool update_ideal_cursor_position)
 	if (text_element->GetFontFaceHandle() == 0 || lines.empty())
 		return;
 
+	parent->DirtyRender();
+
 	int cursor_line_index = 0, cursor_character_index = 0;
 	GetRelativeCursorIndices(cursor_line_index, cursor_character_index);
 
@@ -66,6 +66,13 @@ int FontEngineInterfaceDefault::GenerateString(RenderManager& render_manager, Fo
 		(int)font_effects_handle);
 }
 
+int FontEngineInterfaceDefault::GenerateStringGlyphs(RenderManager& render_manager, FontFaceHandle handle, FontEffectsHandle font_effects_handle,
+	StringView string, Vector2f position, const TextShapingContext& text_shaping_context, TexturedGlyphsList& glyphs_list)
+{
+	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+	return handle_default->GenerateStringGlyphs(render_manager, glyphs_list, string, position, text_shaping_context, (int)font_effects_handle);
+}
+
 int FontEngineInterfaceDefault::GetVersion(FontFaceHandle handle)
 {
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
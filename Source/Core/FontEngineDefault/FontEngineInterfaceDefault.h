@@ -42,6 +42,10 @@ public:
 		Vector2f position, ColourbPremultiplied colour, float opacity, const TextShapingContext& text_shaping_context,
 		TexturedMeshList& mesh_list) override;
 
+	/// Generates the glyphs required to render a single line of text.
+	int GenerateStringGlyphs(RenderManager& render_manager, FontFaceHandle face_handle, FontEffectsHandle effects_handle, StringView string,
+		Vector2f position, const TextShapingContext& text_shaping_context, TexturedGlyphsList& glyphs_list) override;
+
 	/// Returns the current version of the font face.
 	int GetVersion(FontFaceHandle handle) override;
 
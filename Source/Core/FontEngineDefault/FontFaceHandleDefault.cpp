@@ -170,6 +170,24 @@ bool FontFaceHandleDefault::GenerateLayerTexture(Vector<byte>& texture_data, Vec
 
 int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, const Vector2f position,
 	const ColourbPremultiplied colour, const float opacity, const TextShapingContext& text_shaping_context, const int layer_configuration_index)
+{
+	for (TexturedGlyphs& glyphs : glyphs_buffer)
+		glyphs.glyphs.clear();
+
+	const int line_width = GenerateStringGlyphs(render_manager, glyphs_buffer, string, position, text_shaping_context, layer_configuration_index);
+
+	mesh_list.resize(glyphs_buffer.size());
+	for (size_t i = 0; i < glyphs_buffer.size(); i++)
+	{
+		mesh_list[i].texture = glyphs_buffer[i].texture;
+		MeshUtilities::GenerateGlyphs(mesh_list[i].mesh, glyphs_buffer[i], colour, opacity);
+	}
+
+	return line_width;
+}
+
+int FontFaceHandleDefault::GenerateStringGlyphs(RenderManager& render_manager, TexturedGlyphsList& glyphs_list, StringView string,
+	const Vector2f position, const TextShapingContext& text_shaping_context, const int layer_configuration_index)
 {
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int)layer_configurations.size());
@@ -181,40 +199,38 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 
 	UpdateLayersOnDirty();
 
-	// Fetch the requested configuration and generate the geometry for each one.
+	// Fetch the requested configuration and generate the glyphs for each one.
 	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
 
-	// Each texture represents one geometry.
+	// Each texture represents one list of glyphs.
 	const int num_geometries = std::accumulate(layer_configuration.begin(), layer_configuration.end(), 0,
 		[](int sum, const FontFaceLayer* layer) { return sum + layer->GetNumTextures(); });
 
-	mesh_list.resize(num_geometries);
+	glyphs_list.resize(num_geometries);
 
 	for (size_t layer_index = 0; layer_index < layer_configuration.size(); ++layer_index)
 	{
 		FontFaceLayer* layer = layer_configuration[layer_index];
 
-		ColourbPremultiplied layer_colour;
-		if (layer == base_layer)
-			layer_colour = colour;
-		else
-			layer_colour = layer->GetColour(opacity);
-
 		const int num_textures = layer->GetNumTextures();
 		if (num_textures == 0)
 			continue;
 
-		RMLUI_ASSERT(geometry_index + num_textures <= (int)mesh_list.size());
+		RMLUI_ASSERT(geometry_index + num_textures <= (int)glyphs_list.size());
 
 		line_width = 0;
 		Character prior_character = Character::Null;
 
-		// Set the mesh and textures to the geometries.
+		// Set the textures and colours of the glyph lists.
 		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
-			mesh_list[geometry_index + tex_index].texture = layer->GetTexture(render_manager, tex_index);
+		{
+			TexturedGlyphs& glyphs = glyphs_list[geometry_index + tex_index];
+			glyphs.texture = layer->GetTexture(render_manager, tex_index);
+			glyphs.text_colour = (layer == base_layer);
+			glyphs.effect_colour = layer->GetColour();
+		}
 
-		mesh_list[geometry_index].mesh.indices.reserve(string.size() * 6);
-		mesh_list[geometry_index].mesh.vertices.reserve(string.size() * 4);
+		glyphs_list[geometry_index].glyphs.reserve(glyphs_list[geometry_index].glyphs.size() + string.size());
 
 		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 		{
@@ -228,12 +244,10 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 			if (is_kerning_enabled)
 				line_width += GetKerning(prior_character, character, has_set_size);
 
-			ColourbPremultiplied glyph_color = layer_colour;
 			// Use white vertex colors on RGB glyphs.
-			if (layer == base_layer && glyph->color_format == ColorFormat::RGBA8)
-				glyph_color = ColourbPremultiplied(layer_colour.alpha, layer_colour.alpha);
+			const bool coloured_glyph = (layer == base_layer && glyph->color_format == ColorFormat::RGBA8);
 
-			layer->GenerateGeometry(&mesh_list[geometry_index], character, Vector2f(position.x + line_width, position.y), glyph_color);
+			layer->GenerateGlyph(&glyphs_list[geometry_index], character, Vector2f(position.x + line_width, position.y), coloured_glyph);
 
 			line_width += glyph->advance;
 			line_width += (int)text_shaping_context.letter_spacing;
@@ -243,6 +257,10 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 		geometry_index += num_textures;
 	}
 
+	// Glyphs appended above are not part of the layers yet, thus the string must be regenerated after the next update.
+	if (is_layers_dirty)
+		strings_missing_glyphs = true;
+
 	return Math::Max(line_width, 0);
 }
 
@@ -250,20 +268,37 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
 
-	// If we are dirty, regenerate all the layers and increment the version
 	if (is_layers_dirty && base_layer)
 	{
 		is_layers_dirty = false;
-		++version;
 
-		// Regenerate all the layers.
-		// Note: The layer regeneration needs to happen in the order in which the layers were created,
-		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
-		for (auto& pair : layers)
+		// Try to add the new glyphs to the existing layers first, this keeps the version and thereby all generated strings valid.
+		// Note: Layers need to be updated in the order in which they were created, so that any layer they clone has already been updated.
+		bool glyphs_added = !strings_missing_glyphs;
+		for (auto it = layers.begin(); glyphs_added && it != layers.end(); ++it)
 		{
-			GenerateLayer(pair.layer.get());
+			FontFaceLayer* layer = it->layer.get();
+			bool clone_glyph_origins = true;
+			const FontFaceLayer* clone = (it->font_effect ? GetCloneLayer(layer, clone_glyph_origins) : nullptr);
+			glyphs_added = layer->AddGlyphs(this, appended_glyphs, clone, clone_glyph_origins);
+		}
+
+		if (!glyphs_added)
+		{
+			// Increment the version first, the textures of the regenerated layers are tied to it.
+			++version;
+
+			// Regenerate all the layers.
+			// Note: The layer regeneration needs to happen in the order in which the layers were created,
+			// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
+			for (auto& pair : layers)
+			{
+				GenerateLayer(pair.layer.get());
+			}
 		}
 
+		appended_glyphs.clear();
+		strings_missing_glyphs = false;
 		result = true;
 	}
 
@@ -361,6 +396,7 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 			}
 
 			is_layers_dirty = true;
+			appended_glyphs.push_back(character);
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -378,7 +414,10 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
 					if (pair.second)
+					{
 						is_layers_dirty = true;
+						appended_glyphs.push_back(character);
+					}
 					break;
 				}
 			}
@@ -434,33 +473,36 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 	}
 	else
 	{
-		// Determine which, if any, layer the new layer should copy its geometry and textures from.
-		FontFaceLayer* clone = nullptr;
 		bool clone_glyph_origins = true;
-		String generation_key;
-		size_t fingerprint = font_effect->GetFingerprint();
-
-		if (!font_effect->HasUniqueTexture())
-		{
-			clone = base_layer;
-			clone_glyph_origins = false;
-		}
-		else
-		{
-			auto cache_iterator = layer_cache.find(fingerprint);
-			if (cache_iterator != layer_cache.end() && cache_iterator->second != layer)
-				clone = cache_iterator->second;
-		}
+		FontFaceLayer* clone = GetCloneLayer(layer, clone_glyph_origins);
 
 		// Create a new layer.
 		result = layer->Generate(this, clone, clone_glyph_origins);
 
 		// Cache the layer in the layer cache if it generated its own textures (ie, didn't clone).
 		if (!clone)
-			layer_cache[fingerprint] = layer;
+			layer_cache[font_effect->GetFingerprint()] = layer;
 	}
 
 	return result;
 }
 
+FontFaceLayer* FontFaceHandleDefault::GetCloneLayer(const FontFaceLayer* layer, bool& clone_glyph_origins)
+{
+	const FontEffect* font_effect = layer->GetFontEffect();
+	RMLUI_ASSERT(font_effect);
+
+	if (!font_effect->HasUniqueTexture())
+	{
+		clone_glyph_origins = false;
+		return base_layer;
+	}
+
+	auto cache_iterator = layer_cache.find(font_effect->GetFingerprint());
+	if (cache_iterator != layer_cache.end() && cache_iterator->second != layer)
+		return cache_iterator->second;
+
+	return nullptr;
+}
+
 } // namespace Rml
@@ -58,6 +58,17 @@ public:
 	int GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, Vector2f position, ColourbPremultiplied colour,
 		float opacity, const TextShapingContext& text_shaping_context, int layer_configuration);
 
+	/// Generates the glyphs required to render a single line of text.
+	/// @param[in] render_manager The render manager responsible for rendering the string.
+	/// @param[out] glyphs_list A list to place the new glyphs into.
+	/// @param[in] string The string to render.
+	/// @param[in] position The position of the baseline of the first character to render.
+	/// @param[in] text_shaping_context Extra parameters that provide context for text shaping.
+	/// @param[in] layer_configuration Face configuration index to use for generating string.
+	/// @return The width, in pixels, of the string.
+	int GenerateStringGlyphs(RenderManager& render_manager, TexturedGlyphsList& glyphs_list, StringView string, Vector2f position,
+		const TextShapingContext& text_shaping_context, int layer_configuration);
+
 	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
 	int GetVersion() const;
 
@@ -89,6 +100,9 @@ private:
 	// (Re-)generate a layer in this font face handle.
 	bool GenerateLayer(FontFaceLayer* layer);
 
+	// Determine which, if any, layer the given layer should copy its geometry and textures from.
+	FontFaceLayer* GetCloneLayer(const FontFaceLayer* layer, bool& clone_glyph_origins);
+
 	FontGlyphMap glyphs;
 
 	struct EffectLayerPair {
@@ -116,6 +130,13 @@ private:
 	bool is_layers_dirty = false;
 	int version = 0;
 
+	// Glyphs added since the layers were last updated, and whether any strings were generated while missing some of them.
+	Vector<Character> appended_glyphs;
+	bool strings_missing_glyphs = false;
+
+	// Glyphs of the last string generated as meshes, kept to reuse their allocations.
+	TexturedGlyphsList glyphs_buffer;
+
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
 
@@ -17,10 +17,11 @@ FontFaceLayer::~FontFaceLayer() {}
 
 bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
 {
+	// Regenerating an existing layer means new glyphs did not fit into its textures, leave room for more of them this time.
+	const bool reserve_free_space = (texture_layout.GetNumRectangles() > 0);
+
 	// Clear the old layout if it exists.
 	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
 		texture_layout = TextureLayout{};
 		character_boxes.clear();
 		textures_owned.clear();
@@ -101,27 +102,16 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 
 		// Generate the texture layout; this will position the glyph rectangles efficiently and
 		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
+		if (!texture_layout.GenerateLayout(max_texture_dimensions, reserve_free_space))
 			return false;
 
 		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
 		// appropriate and generating geometry.
 		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
 		{
-			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
+			Character character = (Character)texture_layout.GetRectangle(i).GetId();
 			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
+			SetTextureCoordinates(character_boxes[character], i);
 		}
 
 		const FontEffect* effect_ptr = effect.get();
@@ -153,13 +143,113 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 	return true;
 }
 
+bool FontFaceLayer::AddGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters, const FontFaceLayer* clone,
+	bool clone_glyph_origins)
+{
+	const FontGlyphMap& glyphs = handle->GetGlyphs();
+
+	if (clone)
+	{
+		if (textures_ptr != clone->textures_ptr)
+			return false;
+
+		for (Character character : characters)
+		{
+			auto it_glyph = glyphs.find(character);
+			auto it_box = clone->character_boxes.find(character);
+			if (it_glyph == glyphs.end() || it_box == clone->character_boxes.end())
+				continue;
+
+			TextureBox box = it_box->second;
+
+			if (effect && !clone_glyph_origins)
+			{
+				Vector2i glyph_origin = Vector2i(box.origin);
+				Vector2i glyph_dimensions = Vector2i(box.dimensions);
+
+				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, it_glyph->second))
+					box.origin = Vector2f(glyph_origin);
+				else
+					box.texture_index = -1;
+			}
+
+			character_boxes[character] = box;
+		}
+
+		return true;
+	}
+
+	// The layer was previously generated as a clone, instead it now needs its own textures.
+	if (textures_ptr != &textures_owned)
+		return false;
+
+	Vector<byte> data;
+
+	for (Character character : characters)
+	{
+		auto it_glyph = glyphs.find(character);
+		if (it_glyph == glyphs.end() || character_boxes.count(character))
+			continue;
+
+		const FontGlyph& glyph = it_glyph->second;
+
+		Vector2i glyph_origin(0, 0);
+		Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+
+		if (effect)
+		{
+			if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+				continue;
+		}
+
+		const int rectangle_index = texture_layout.InsertRectangle((int)character, glyph_dimensions);
+		if (rectangle_index < 0)
+			return false;
+
+		TextureBox box;
+		box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+		box.dimensions = Vector2f(glyph_dimensions);
+		SetTextureCoordinates(box, rectangle_index);
+
+		// Write the glyph into any textures that have already been generated, others will include it once they are generated.
+		if (glyph_dimensions.x > 0 && glyph_dimensions.y > 0)
+		{
+			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(rectangle_index);
+			const int stride = glyph_dimensions.x * 4;
+			data.assign(size_t(stride * glyph_dimensions.y), byte(0));
+			GenerateGlyphTexture(data.data(), stride, box, glyph);
+
+			textures_owned[box.texture_index].UpdateRegion(data, Rectanglei::FromPositionSize(rectangle.GetPosition(), glyph_dimensions));
+		}
+
+		character_boxes[character] = box;
+	}
+
+	return true;
+}
+
+void FontFaceLayer::SetTextureCoordinates(TextureBox& box, int rectangle_index)
+{
+	TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(rectangle_index);
+	const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
+
+	// Set the character's texture index.
+	box.texture_index = rectangle.GetTextureIndex();
+
+	// Generate the character's texture coordinates.
+	box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
+	box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
+	box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
+	box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
+}
+
 bool FontFaceLayer::GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
 {
 	if (texture_id < 0 || texture_id > texture_layout.GetNumTextures())
 		return false;
 
 	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
+	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture(texture_layout);
 	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
 
 	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
@@ -177,48 +267,50 @@ bool FontFaceLayer::GenerateTexture(Vector<byte>& texture_data, Vector2i& textur
 		if (it == glyphs.end())
 			continue;
 
-		const FontGlyph& glyph = it->second;
+		GenerateGlyphTexture(rectangle.GetTextureData(), rectangle.GetTextureStride(), box, it->second);
+	}
 
-		if (effect == nullptr)
+	return true;
+}
+
+void FontFaceLayer::GenerateGlyphTexture(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const
+{
+	if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				switch (glyph.color_format)
+				{
+				case ColorFormat::A8:
+				{
+					// We use premultiplied alpha, so copy the alpha into all four channels.
+					for (int k = 0; k < num_bytes_per_line; ++k)
+						for (int c = 0; c < 4; ++c)
+							destination[k * 4 + c] = source[k];
+				}
+				break;
+				case ColorFormat::RGBA8:
 				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						// We use premultiplied alpha, so copy the alpha into all four channels.
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							for (int c = 0; c < 4; ++c)
-								destination[k * 4 + c] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
+					memcpy(destination, source, num_bytes_per_line);
 				}
+				break;
+				}
+
+				destination += stride;
+				source += num_bytes_per_line;
 			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
 	}
-
-	return true;
+	else
+	{
+		effect->GenerateGlyphTexture(destination, Vector2i(box.dimensions), stride, glyph);
+	}
 }
 
 const FontEffect* FontFaceLayer::GetFontEffect() const
@@ -239,9 +331,9 @@ int FontFaceLayer::GetNumTextures() const
 	return (int)textures_ptr->size();
 }
 
-ColourbPremultiplied FontFaceLayer::GetColour(float opacity) const
+Colourb FontFaceLayer::GetColour() const
 {
-	return colour.ToPremultiplied(opacity);
+	return colour;
 }
 
 } // namespace Rml
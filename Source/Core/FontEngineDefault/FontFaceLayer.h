@@ -28,6 +28,14 @@ public:
 	/// @return True if the layer was generated successfully, false if not.
 	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
+	/// Adds new glyphs to the already generated layer, placing them in the free space of the existing textures.
+	/// @param[in] handle The handle generating this layer.
+	/// @param[in] characters The characters of the glyphs recently added to the handle.
+	/// @param[in] clone The layer this layer was generated from, if any, which must already have added the glyphs.
+	/// @param[in] clone_glyph_origins True to keep the character origins from the cloned layer, false to generate new ones.
+	/// @return True if all glyphs were added, otherwise the layer must be generated again.
+	bool AddGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters, const FontFaceLayer* clone, bool clone_glyph_origins);
+
 	/// Generates the texture data for a layer (for the texture database).
 	/// @param[out] texture_data The generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
@@ -35,13 +43,12 @@ public:
 	/// @param[in] glyphs The glyphs required by the font face handle.
 	bool GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
 
-	/// Generates the geometry required to render a single character.
-	/// @param[out] mesh_list An array of meshes this layer will write to. It must be at least as big as the number of textures in this layer.
-	/// @param[in] character_code The character to generate geometry for.
+	/// Generates the glyph instance required to render a single character.
+	/// @param[out] glyphs_list An array of glyph lists this layer will write to. It must be at least as big as the number of textures in this layer.
+	/// @param[in] character_code The character to generate the glyph for.
 	/// @param[in] position The position of the baseline.
-	/// @param[in] colour The colour of the string.
-	inline void GenerateGeometry(TexturedMesh* mesh_list, const Character character_code, const Vector2f position,
-		const ColourbPremultiplied colour) const
+	/// @param[in] coloured_glyph True if the glyph has colours of its own.
+	inline void GenerateGlyph(TexturedGlyphs* glyphs_list, const Character character_code, const Vector2f position, const bool coloured_glyph) const
 	{
 		auto it = character_boxes.find(character_code);
 		if (it == character_boxes.end())
@@ -52,9 +59,14 @@ public:
 		if (box.texture_index < 0)
 			return;
 
-		// Generate the geometry for the character.
-		Mesh& mesh = mesh_list[box.texture_index].mesh;
-		MeshUtilities::GenerateQuad(mesh, (position + box.origin).Round(), box.dimensions, colour, box.texcoords[0], box.texcoords[1]);
+		// Generate the glyph for the character.
+		GlyphInstance glyph;
+		glyph.position = (position + box.origin).Round();
+		glyph.dimensions = box.dimensions;
+		glyph.top_left_texcoord = box.texcoords[0];
+		glyph.bottom_right_texcoord = box.texcoords[1];
+		glyph.coloured_glyph = coloured_glyph;
+		glyphs_list[box.texture_index].glyphs.push_back(glyph);
 	}
 
 	/// Returns the effect used to generate the layer.
@@ -65,8 +77,8 @@ public:
 	/// Returns the number of textures employed by this layer.
 	int GetNumTextures() const;
 
-	/// Returns the layer's colour after applying the given opacity.
-	ColourbPremultiplied GetColour(float opacity) const;
+	/// Returns the layer's colour.
+	Colourb GetColour() const;
 
 private:
 	struct TextureBox {
@@ -84,6 +96,12 @@ private:
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
 	using TextureList = Vector<CallbackTextureSource>;
 
+	// Sets the texture index and coordinates of the box from its placed rectangle in the texture layout.
+	void SetTextureCoordinates(TextureBox& box, int rectangle_index);
+
+	// Writes the texture data of a single glyph into the given destination.
+	void GenerateGlyphTexture(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const;
+
 	SharedPtr<const FontEffect> effect;
 
 	TextureList textures_owned;
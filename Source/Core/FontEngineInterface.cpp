@@ -58,6 +58,13 @@ int FontEngineInterface::GenerateString(RenderManager& /*render_manager*/, FontF
 	return 0;
 }
 
+int FontEngineInterface::GenerateStringGlyphs(RenderManager& /*render_manager*/, FontFaceHandle /*face_handle*/,
+	FontEffectsHandle /*font_effects_handle*/, StringView /*string*/, Vector2f /*position*/, const TextShapingContext& /*text_shaping_context*/,
+	TexturedGlyphsList& /*glyphs_list*/)
+{
+	return -1;
+}
+
 int FontEngineInterface::GetVersion(FontFaceHandle /*handle*/)
 {
 	return 0;
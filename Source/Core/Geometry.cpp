@@ -30,6 +30,12 @@ Mesh Geometry::Release(ReleaseMode mode)
 	return mesh;
 }
 
+void Geometry::UpdateMesh(Mesh&& mesh)
+{
+	RMLUI_ASSERT(resource_handle != StableVectorIndex::Invalid);
+	RenderManagerAccess::UpdateMesh(render_manager, *this, std::move(mesh));
+}
+
 const Mesh& Geometry::GetMesh() const
 {
 	RMLUI_ASSERT(resource_handle != StableVectorIndex::Invalid);
@@ -0,0 +1,219 @@
+#include "HitTestGrid.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "ElementMeta.h"
+#include "TransformState.h"
+#include <algorithm>
+#include <float.h>
+
+namespace Rml {
+
+bool HitTestGrid::Update(Element* owner, Vector2i dimensions)
+{
+	if (dimensions != grid_dimensions)
+	{
+		grid_dimensions = dimensions;
+		Invalidate();
+	}
+
+	switch (state)
+	{
+	case State::Changed:
+		// The stacking context changed since the previous lookup, wait for the next one to see if the layout settles before building the grid.
+		state = State::Settling;
+		return false;
+	case State::Settling:
+		state = State::Built;
+		valid = Build(owner, dimensions);
+		break;
+	case State::Built:
+		if (valid)
+		{
+			// Positions are placed relative to the owner, so that the cells of unchanged entries remain valid even if the owner has moved.
+			owner_shift = build_owner_offset - owner->GetAbsoluteOffset(BoxArea::Border);
+			if (!dirty_entries.empty())
+				UpdateDirtyEntries(owner);
+		}
+		break;
+	}
+
+	return valid;
+}
+
+void HitTestGrid::Invalidate()
+{
+	state = State::Changed;
+	valid = false;
+	dirty_entries.clear();
+}
+
+void HitTestGrid::InvalidateElement(Element* element)
+{
+	Element* parent = element->GetParentNode();
+	if (!parent)
+		return;
+
+	if (Element* stacking_context_parent = parent->ClosestStackingContextContainer())
+		stacking_context_parent->meta->hit_test_grid.InvalidateEntry(element);
+}
+
+void HitTestGrid::InvalidateDescendants(Element* element)
+{
+	if (Element* stacking_context_parent = element->ClosestStackingContextContainer())
+		stacking_context_parent->meta->hit_test_grid.Invalidate();
+}
+
+void HitTestGrid::InvalidateEntry(Element* element)
+{
+	// Entries are only tracked once the grid has been built, otherwise the whole grid is going to be built anyway.
+	if (state != State::Built || !valid)
+		return;
+
+	auto it = entry_indices.find(element);
+	if (it == entry_indices.end())
+		return;
+
+	Entry& entry = entries[it->second];
+	if (!entry.dirty)
+	{
+		entry.dirty = true;
+		dirty_entries.push_back(it->second);
+	}
+}
+
+bool HitTestGrid::Build(Element* owner, Vector2i dimensions)
+{
+	const Vector<Element*>& stacking_context = owner->stacking_context;
+
+	num_columns = (dimensions.x + cell_size - 1) / cell_size;
+	num_rows = (dimensions.y + cell_size - 1) / cell_size;
+	if (num_columns <= 0 || num_rows <= 0)
+		return false;
+
+	build_owner_offset = owner->GetAbsoluteOffset(BoxArea::Border);
+	owner_shift = Vector2f(0);
+
+	for (Vector<int>& cell : cells)
+		cell.clear();
+	cells.resize(num_columns * num_rows);
+	always_entries.clear();
+
+	entries.assign(stacking_context.size(), Entry{});
+	entry_indices.clear();
+	entry_indices.reserve(stacking_context.size());
+	dirty_entries.clear();
+
+	for (int i = 0; i < (int)stacking_context.size(); i++)
+	{
+		Element* element = stacking_context[i];
+		entry_indices[element] = i;
+
+		if (!PlaceEntry(i, element))
+		{
+			entries[i].dirty = true;
+			dirty_entries.push_back(i);
+		}
+	}
+
+	return true;
+}
+
+void HitTestGrid::UpdateDirtyEntries(Element* owner)
+{
+	Vector<int> updated_entries;
+	updated_entries.swap(dirty_entries);
+
+	for (int index : updated_entries)
+	{
+		RMLUI_ASSERT(index < (int)owner->stacking_context.size());
+		Element* element = owner->stacking_context[index];
+
+		RemoveEntry(index);
+		entries[index].dirty = false;
+
+		if (!PlaceEntry(index, element))
+		{
+			entries[index].dirty = true;
+			dirty_entries.push_back(index);
+		}
+	}
+}
+
+bool HitTestGrid::PlaceEntry(int index, Element* element)
+{
+	Entry& entry = entries[index];
+
+	// Transformed elements are hit tested in their local space, thus their boxes cannot be placed in the grid. Instead, they are always
+	// considered together with elements that have their own local stacking context. Pending transforms are resolved during rendering.
+	const bool transform_pending = (element->dirty_transform || element->dirty_perspective);
+	const TransformState* transform_state = element->GetTransformState();
+	if (element->local_stacking_context || transform_pending || (transform_state && transform_state->GetTransform()))
+	{
+		entry.always = true;
+		always_entries.insert(std::lower_bound(always_entries.begin(), always_entries.end(), index), index);
+		return !transform_pending;
+	}
+
+	// Find the bounds of all the boxes of the element, corresponding to the area tested by Element::IsPointWithinElement.
+	const Vector2f position = element->GetAbsoluteOffset(BoxArea::Border) + owner_shift;
+	Vector2f min = Vector2f(FLT_MAX);
+	Vector2f max = Vector2f(-FLT_MAX);
+	for (int j = 0; j < element->GetNumBoxes(); j++)
+	{
+		Vector2f box_offset;
+		const Box& box = element->GetBox(j, box_offset);
+		min = Math::Min(min, position + box_offset);
+		max = Math::Max(max, position + box_offset + box.GetSize(BoxArea::Border));
+	}
+
+	if (max.x < 0.f || max.y < 0.f || min.x > float(num_columns * cell_size) || min.y > float(num_rows * cell_size))
+		return true;
+
+	entry.in_cells = true;
+	entry.cell_min = Math::Max(Vector2i(min / float(cell_size)), Vector2i(0));
+	entry.cell_max = Math::Min(Vector2i(max / float(cell_size)), Vector2i(num_columns - 1, num_rows - 1));
+
+	for (int y = entry.cell_min.y; y <= entry.cell_max.y; y++)
+	{
+		for (int x = entry.cell_min.x; x <= entry.cell_max.x; x++)
+		{
+			Vector<int>& cell = cells[y * num_columns + x];
+			if (cell.empty() || cell.back() < index)
+				cell.push_back(index);
+			else
+				cell.insert(std::lower_bound(cell.begin(), cell.end(), index), index);
+		}
+	}
+
+	return true;
+}
+
+void HitTestGrid::RemoveEntry(int index)
+{
+	Entry& entry = entries[index];
+
+	if (entry.always)
+	{
+		auto it = std::lower_bound(always_entries.begin(), always_entries.end(), index);
+		RMLUI_ASSERT(it != always_entries.end() && *it == index);
+		always_entries.erase(it);
+		entry.always = false;
+	}
+
+	if (entry.in_cells)
+	{
+		for (int y = entry.cell_min.y; y <= entry.cell_max.y; y++)
+		{
+			for (int x = entry.cell_min.x; x <= entry.cell_max.x; x++)
+			{
+				Vector<int>& cell = cells[y * num_columns + x];
+				auto it = std::lower_bound(cell.begin(), cell.end(), index);
+				RMLUI_ASSERT(it != cell.end() && *it == index);
+				cell.erase(it);
+			}
+		}
+		entry.in_cells = false;
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/*
+    A uniform grid over the border boxes of the elements in a local stacking context, used to speed up hit testing.
+
+    Each cell lists the stacking children whose boxes overlap it, in stacking order. Children with their own local stacking context are
+    always considered, since their descendants may be located anywhere, as are transformed children. The grid only acts as a filter, every
+    candidate still needs to be tested against the point.
+
+    The boxes are stored relative to the element owning the grid, so that moving or scrolling its ancestors does not affect the grid. Changes
+    to the box, offset, or transform of a stacking child only update the cells covered by its old and new boxes. The grid is fully rebuilt
+    when its stacking context changes or its contents are scrolled, lazily after the layout has remained unchanged for consecutive lookups,
+    so that continuously changing documents do not pay for rebuilding it.
+*/
+class HitTestGrid {
+public:
+	/// Prepares the grid for lookups in the stacking context of the given element, updating it if necessary.
+	/// @param[in] owner The element owning this grid.
+	/// @param[in] dimensions The dimensions of the context, points outside this area are not covered by the grid.
+	/// @return True if the grid is ready to be used for lookups.
+	bool Update(Element* owner, Vector2i dimensions);
+
+	/// Visits the indices of the stacking children which may contain the given point, in front-to-back order, until the function returns true.
+	/// @return False if the point is not covered by the grid, in which case all stacking children must be tested instead.
+	template <typename Func>
+	bool ForEachCandidate(Vector2f point, Func&& func) const;
+
+	/// Invalidates the whole grid, such as when the stacking context has changed.
+	void Invalidate();
+
+	/// Updates the entry of the given element in the grid of its stacking context, such as when it has been moved or resized.
+	static void InvalidateElement(Element* element);
+	/// Invalidates the grid containing the descendants of the given element, such as when it has been scrolled.
+	static void InvalidateDescendants(Element* element);
+
+private:
+	struct Entry {
+		Vector2i cell_min, cell_max;
+		bool in_cells = false;
+		bool always = false;
+		bool dirty = false;
+	};
+
+	enum class State { Changed, Settling, Built };
+
+	bool Build(Element* owner, Vector2i dimensions);
+	void InvalidateEntry(Element* element);
+	void UpdateDirtyEntries(Element* owner);
+
+	// Returns false if the entry could not be placed definitively, such as when its transform is pending, and should be updated again later.
+	bool PlaceEntry(int index, Element* element);
+	void RemoveEntry(int index);
+
+	static constexpr int cell_size = 64;
+
+	State state = State::Changed;
+	bool valid = false;
+
+	int num_columns = 0;
+	int num_rows = 0;
+	Vector2i grid_dimensions;
+
+	// The grid is placed in the coordinates of the owner's position when it was built, the shift is applied to positions in the current layout.
+	Vector2f build_owner_offset;
+	Vector2f owner_shift;
+
+	// The entries of each cell, and the entries that are always considered, are sorted in ascending order.
+	Vector<Vector<int>> cells;
+	Vector<int> always_entries;
+
+	Vector<Entry> entries;
+	UnorderedMap<Element*, int> entry_indices;
+	Vector<int> dirty_entries;
+};
+
+template <typename Func>
+bool HitTestGrid::ForEachCandidate(Vector2f point, Func&& func) const
+{
+	RMLUI_ASSERT(valid);
+
+	point += owner_shift;
+
+	const int column = int(point.x) / cell_size;
+	const int row = int(point.y) / cell_size;
+	if (point.x < 0.f || point.y < 0.f || column >= num_columns || row >= num_rows)
+		return false;
+
+	const Vector<int>& cell_entries = cells[row * num_columns + column];
+
+	// Merge the entries of the cell with the entries that are always considered.
+	int i = (int)cell_entries.size() - 1;
+	int j = (int)always_entries.size() - 1;
+
+	while (i >= 0 || j >= 0)
+	{
+		int index;
+		if (j < 0 || (i >= 0 && cell_entries[i] > always_entries[j]))
+			index = cell_entries[i--];
+		else
+			index = always_entries[j--];
+
+		if (func(index))
+			break;
+	}
+
+	return true;
+}
+
+} // namespace Rml
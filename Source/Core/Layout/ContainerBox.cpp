@@ -29,6 +29,15 @@ void ContainerBox::AddAbsoluteElement(Element* element, Vector2f static_position
 {
 	// We may possibly be adding the same element from a previous layout iteration. If so, this ensures it is updated with the latest static position.
 	absolute_elements[element] = AbsoluteElement{static_position, static_relative_offset_parent};
+	num_absolute_elements_added += 1;
+}
+
+int ContainerBox::CountAbsoluteElementsAddedRecursive() const
+{
+	int count = 0;
+	for (const ContainerBox* container = this; container; container = container->parent_container)
+		count += container->num_absolute_elements_added;
+	return count;
 }
 
 void ContainerBox::AddRelativeElement(Element* element)
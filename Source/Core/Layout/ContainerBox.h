@@ -31,6 +31,11 @@ public:
 	// Adds a relatively positioned element which we act as a containing block for.
 	void AddRelativeElement(Element* element);
 
+	// Returns true if any absolutely positioned elements have been added to this box, which are yet to be formatted.
+	bool HasAbsoluteElements() const { return !absolute_elements.empty(); }
+	// Returns the number of times absolutely positioned elements have been added to this box and all of its ancestors.
+	int CountAbsoluteElementsAddedRecursive() const;
+
 	ContainerBox* GetParent() { return parent_container; }
 	Element* GetElement() { return element; }
 
@@ -78,6 +83,7 @@ private:
 	Style::Overflow overflow_x = Style::Overflow::Visible;
 	Style::Overflow overflow_y = Style::Overflow::Visible;
 	bool is_absolute_positioning_containing_block = false;
+	int num_absolute_elements_added = 0;
 
 	ContainerBox* parent_container = nullptr;
 };
@@ -94,6 +94,10 @@ UniquePtr<LayoutBox> FlexFormattingContext::Format(ContainerBox* parent_containe
 
 Vector2f FlexFormattingContext::GetMaxContentSize(Element* element)
 {
+	// The flex items are formatted below without going through the flex container, thus the container and its ancestors can no longer reuse
+	// their previous formatting results.
+	FormattingContext::InvalidateFormattingCache(element);
+
 	// A large but finite number is used here, since layouting doesn't always work well with infinities.
 	const Vector2f infinity(10000.0f, 10000.0f);
 	RootBox root(infinity);
@@ -337,7 +341,7 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 			if (initial_box_size.x < 0.f && flex_available_content_size.x >= 0.f)
 				format_box.SetContent(Vector2f(flex_available_content_size.x - item.cross.sum_edges, initial_box_size.y));
 
-			FormattingContext::FormatIndependent(flex_container_box, element, (format_box.GetSize().x >= 0 ? &format_box : nullptr),
+			FormattingContext::FormatIndependentCached(flex_container_box, element, (format_box.GetSize().x >= 0 ? &format_box : nullptr),
 				FormattingContextType::Block);
 			item.inner_flex_base_size = element->GetBox().GetSize().y;
 
@@ -680,7 +684,7 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 				if (content_size.y < 0.0f)
 				{
 					item.box.SetContent(Vector2f(GetInnerUsedMainSize(item), content_size.y));
-					FormattingContext::FormatIndependent(flex_container_box, item.element, &item.box, FormattingContextType::Block);
+					FormattingContext::FormatIndependentCached(flex_container_box, item.element, &item.box, FormattingContextType::Block);
 					item.hypothetical_cross_size = item.element->GetBox().GetSize().y + item.cross.sum_edges;
 				}
 				else
@@ -952,21 +956,21 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 
 			item.box.SetContent(item_size);
 
-			UniquePtr<LayoutBox> item_layout_box =
-				FormattingContext::FormatIndependent(flex_container_box, item.element, &item.box, FormattingContextType::Block);
+			const FormattingResults item_results =
+				FormattingContext::FormatIndependentCached(flex_container_box, item.element, &item.box, FormattingContextType::Block);
 
 			// Set the position of the element within the flex container
 			item.element->SetOffset(flex_content_offset + item_offset, element_flex);
 
 			// The flex container baseline is simply set to the first flex item that has a baseline.
-			if (!baseline_set && item_layout_box->GetBaselineOfLastLine(flex_baseline))
+			if (!baseline_set && item_results.has_baseline_of_last_line)
 			{
-				flex_baseline += flex_content_offset.y + item_offset.y;
+				flex_baseline = item_results.baseline_of_last_line + flex_content_offset.y + item_offset.y;
 				baseline_set = true;
 			}
 
 			// The item and its contents may overflow, propagate their border-box overflow to the flex container.
-			const Vector2f overflow_size = item_offset + item_layout_box->GetVisibleOverflowSize();
+			const Vector2f overflow_size = item_offset + item_results.visible_overflow_size;
 			flex_visible_overflow_size = Math::Max(flex_visible_overflow_size, overflow_size);
 
 			// Return the margin size of the direct flex items, so that we can scroll over to them with their full margin visible.
@@ -0,0 +1,32 @@
+#include "FormattingCache.h"
+#include "../../../Include/RmlUi/Core/Element.h"
+#include "../../../Include/RmlUi/Core/ElementDocument.h"
+
+namespace Rml {
+
+bool FormattingCache::Find(Element* element, const FormattingCacheInputs& find_inputs, FormattingResults& out_results) const
+{
+	ElementDocument* document = element->GetOwnerDocument();
+	if (!document || generation != document->formatting_cache_generation || !(inputs == find_inputs) || element->GetBox() != box)
+		return false;
+
+	out_results = results;
+	return true;
+}
+
+void FormattingCache::Store(Element* element, const FormattingCacheInputs& store_inputs, const FormattingResults& store_results)
+{
+	ElementDocument* document = element->GetOwnerDocument();
+	if (!document)
+	{
+		Invalidate();
+		return;
+	}
+
+	generation = document->formatting_cache_generation;
+	inputs = store_inputs;
+	box = element->GetBox();
+	results = store_results;
+}
+
+} // namespace Rml
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../../../Include/RmlUi/Core/Box.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "FormattingContext.h"
+
+namespace Rml {
+
+/*
+    The inputs to an independent formatting of an element, other than the element's own properties and those of its descendants.
+*/
+struct FormattingCacheInputs {
+	Vector2f containing_block;
+	FormattingContextType backup_context = FormattingContextType::None;
+	bool has_override_box = false;
+	Box override_box;
+
+	bool operator==(const FormattingCacheInputs& other) const
+	{
+		return containing_block == other.containing_block && backup_context == other.backup_context && has_override_box == other.has_override_box &&
+			(!has_override_box || override_box == other.override_box);
+	}
+};
+
+/*
+    Stores the inputs and results of the most recent independent formatting of an element.
+
+    Formatting an element leaves the boxes and offsets of all its descendants in the state of that formatting. Thus, if the element is
+    formatted again with the same inputs, and nothing affecting the layout of its subtree has changed in the meantime, the stored results
+    can be used directly instead of formatting the whole subtree again. Any formatting of a descendant that does not go through this element
+    invalidates the entry, as does dirtying the layout of the element or any of its descendants.
+*/
+class FormattingCache {
+public:
+	/// Retrieves the results of the most recent formatting, if it is available for the given inputs.
+	/// @return True if the results are available, otherwise the element needs to be formatted.
+	bool Find(Element* element, const FormattingCacheInputs& inputs, FormattingResults& out_results) const;
+
+	/// Stores the results of formatting the element with the given inputs.
+	void Store(Element* element, const FormattingCacheInputs& inputs, const FormattingResults& results);
+
+	/// Invalidates the stored results.
+	void Invalidate() { generation = -1; }
+
+private:
+	// The formatting cache generation of the owning document at the time of formatting, see ElementDocument::DirtyLayout.
+	int generation = -1;
+	FormattingCacheInputs inputs;
+
+	Box box;
+	FormattingResults results;
+};
+
+} // namespace Rml
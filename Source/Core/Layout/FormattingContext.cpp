@@ -2,23 +2,36 @@
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../../Include/RmlUi/Core/Element.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
+#include "../ElementMeta.h"
 #include "BlockFormattingContext.h"
+#include "ContainerBox.h"
 #include "FlexFormattingContext.h"
+#include "FormattingCache.h"
 #include "LayoutBox.h"
+#include "LayoutDetails.h"
 #include "ReplacedFormattingContext.h"
 #include "TableFormattingContext.h"
 
 namespace Rml {
 
-UniquePtr<LayoutBox> FormattingContext::FormatIndependent(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+static FormattingCacheInputs GetFormattingCacheInputs(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
 	FormattingContextType backup_context)
 {
-	RMLUI_ZoneScopedC(0xAFAFAF);
-	using namespace Style;
-
-	if (element->IsReplaced())
-		return ReplacedFormattingContext::Format(parent_container, element, override_initial_box);
+	FormattingCacheInputs inputs;
+	inputs.containing_block = LayoutDetails::GetContainingBlock(parent_container, element->GetPosition()).size;
+	inputs.backup_context = backup_context;
+	if (override_initial_box)
+	{
+		inputs.has_override_box = true;
+		inputs.override_box = *override_initial_box;
+	}
+	return inputs;
+}
 
+static UniquePtr<LayoutBox> FormatIndependentUncached(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+	FormattingContextType backup_context)
+{
+	using namespace Style;
 	FormattingContextType type = backup_context;
 
 	auto& computed = element->GetComputedValues();
@@ -49,4 +62,72 @@ UniquePtr<LayoutBox> FormattingContext::FormatIndependent(ContainerBox* parent_c
 	return nullptr;
 }
 
+UniquePtr<LayoutBox> FormattingContext::FormatIndependent(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+	FormattingContextType backup_context)
+{
+	RMLUI_ZoneScopedC(0xAFAFAF);
+
+	if (element->IsReplaced())
+		return ReplacedFormattingContext::Format(parent_container, element, override_initial_box);
+
+	const FormattingCacheInputs inputs = GetFormattingCacheInputs(parent_container, element, override_initial_box, backup_context);
+	return FormatAndStoreResults(parent_container, element, override_initial_box, backup_context, inputs);
+}
+
+static FormattingResults GetFormattingResults(const LayoutBox* layout_box)
+{
+	FormattingResults results;
+	if (layout_box)
+	{
+		results.visible_overflow_size = layout_box->GetVisibleOverflowSize();
+		results.has_baseline_of_last_line = layout_box->GetBaselineOfLastLine(results.baseline_of_last_line);
+	}
+	return results;
+}
+
+FormattingResults FormattingContext::FormatIndependentCached(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+	FormattingContextType backup_context)
+{
+	RMLUI_ZoneScopedC(0xAFAFAF);
+
+	if (element->IsReplaced())
+		return GetFormattingResults(ReplacedFormattingContext::Format(parent_container, element, override_initial_box).get());
+
+	const FormattingCacheInputs inputs = GetFormattingCacheInputs(parent_container, element, override_initial_box, backup_context);
+
+	FormattingResults results;
+	if (element->meta->formatting_cache.Find(element, inputs, results))
+		return results;
+
+	return GetFormattingResults(FormatAndStoreResults(parent_container, element, override_initial_box, backup_context, inputs).get());
+}
+
+void FormattingContext::InvalidateFormattingCache(Element* element)
+{
+	for (; element; element = element->GetParentNode())
+		element->meta->formatting_cache.Invalidate();
+}
+
+UniquePtr<LayoutBox> FormattingContext::FormatAndStoreResults(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+	FormattingContextType backup_context, const FormattingCacheInputs& inputs)
+{
+	// Formatting the element changes the layout of its subtree, so any ancestors can no longer reuse their previous results.
+	if (Element* parent = element->GetParentNode())
+		InvalidateFormattingCache(parent);
+
+	const int num_absolute_elements_added = parent_container->CountAbsoluteElementsAddedRecursive();
+
+	UniquePtr<LayoutBox> layout_box = FormatIndependentUncached(parent_container, element, override_initial_box, backup_context);
+
+	// Absolutely positioned descendants may be added to containing blocks outside the element. Those won't be found again if we reuse the
+	// results, so we cannot store them in that case.
+	FormattingCache& formatting_cache = element->meta->formatting_cache;
+	if (layout_box && parent_container->CountAbsoluteElementsAddedRecursive() == num_absolute_elements_added)
+		formatting_cache.Store(element, inputs, GetFormattingResults(layout_box.get()));
+	else
+		formatting_cache.Invalidate();
+
+	return layout_box;
+}
+
 } // namespace Rml
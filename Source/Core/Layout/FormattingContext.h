@@ -7,6 +7,7 @@ namespace Rml {
 class Box;
 class ContainerBox;
 class LayoutBox;
+struct FormattingCacheInputs;
 
 enum class FormattingContextType {
 	Block,
@@ -15,6 +16,15 @@ enum class FormattingContextType {
 	None,
 };
 
+/*
+    The results of formatting an element independently, as needed by the formatting context of its parent.
+*/
+struct FormattingResults {
+	Vector2f visible_overflow_size;
+	bool has_baseline_of_last_line = false;
+	float baseline_of_last_line = 0.f;
+};
+
 /*
     An environment in which related boxes are layed out.
 */
@@ -29,9 +39,23 @@ public:
 	static UniquePtr<LayoutBox> FormatIndependent(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
 		FormattingContextType backup_context);
 
+	/// Format the element in an independent formatting context, or reuse the results of its most recent formatting if it was formatted with the
+	/// same inputs, and nothing affecting its layout has changed since then. Only the results needed to place the element are returned, since
+	/// the layout box is not available when reusing results.
+	/// @see FormatIndependent
+	static FormattingResults FormatIndependentCached(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+		FormattingContextType backup_context);
+
+	/// Invalidates any stored formatting results of the element and its ancestors, whose layout may depend on the element.
+	static void InvalidateFormattingCache(Element* element);
+
 protected:
 	FormattingContext() = default;
 	~FormattingContext() = default;
+
+private:
+	static UniquePtr<LayoutBox> FormatAndStoreResults(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+		FormattingContextType backup_context, const FormattingCacheInputs& inputs);
 };
 
 } // namespace Rml
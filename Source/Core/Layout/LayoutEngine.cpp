@@ -1,4 +1,5 @@
 #include "LayoutEngine.h"
+#include "../../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../../Include/RmlUi/Core/Element.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
@@ -30,4 +31,55 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block)
 	}
 }
 
+bool LayoutEngine::FormatLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(element);
+	RMLUI_ZoneScoped;
+
+	Element* parent = element->GetParentNode();
+	if (!parent || !IsLayoutBoundary(element))
+		return false;
+
+	// The box is independent of the element's contents, so we can reuse it from the previous layout. Then the containing block is only used to
+	// resolve any min- and max-sizes, which should already be reflected in this box.
+	const Box box = element->GetBox();
+	const float baseline = element->GetBaseline();
+
+	RootBox root(parent->GetBox().GetSize());
+
+	auto layout_box = FormattingContext::FormatIndependent(&root, element, &box, FormattingContextType::Block);
+	if (!layout_box)
+		return false;
+
+	// Absolutely positioned descendants whose containing block is outside the boundary ended up in our temporary root, they must be formatted
+	// together with their real containing block. Similarly, a changed baseline might move the element within its line or flex line.
+	if (root.HasAbsoluteElements() || element->GetBox() != box || element->GetBaseline() != baseline)
+		return false;
+
+	element->ClampScrollOffsetRecursive();
+
+	return true;
+}
+
+bool LayoutEngine::IsLayoutBoundary(Element* element)
+{
+	using namespace Style;
+	const ComputedValues& computed = element->GetComputedValues();
+
+	switch (computed.display())
+	{
+	case Display::Block:
+	case Display::FlowRoot:
+	case Display::Flex:
+	case Display::InlineBlock:
+	case Display::InlineFlex: break;
+	default: return false;
+	}
+
+	// Percentage sizes may resolve to content-based sizes, such as when the containing block has an auto height. Scroll containers are excluded
+	// from the automatic minimum size of flex items, so that their sizes are independent of their contents also in a flex context.
+	return computed.width().type == Width::Length && computed.height().type == Height::Length && computed.overflow_x() != Overflow::Visible &&
+		computed.overflow_y() != Overflow::Visible && !element->IsReplaced();
+}
+
 } // namespace Rml
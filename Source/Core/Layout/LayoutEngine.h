@@ -14,6 +14,16 @@ public:
 	/// @param[in] element The element to lay out.
 	/// @param[in] containing_block The size of the containing block.
 	static void FormatElement(Element* element, Vector2f containing_block);
+
+	/// Formats the contents of a layout boundary again, keeping its current box and position.
+	/// @param[in] element The layout boundary element, previously formatted as part of its document.
+	/// @return True on success, false if the result could affect the layout outside the element, in which case the document must be formatted.
+	static bool FormatLayoutBoundary(Element* element);
+
+	/// Returns true if the element acts as a layout boundary. That is, it establishes an independent formatting context with a border box that
+	/// does not depend on its contents, and it catches all overflow of its descendants. Thus, changes to its descendants cannot affect the layout
+	/// of any elements outside of it.
+	static bool IsLayoutBoundary(Element* element);
 };
 
 } // namespace Rml
@@ -277,7 +277,7 @@ void TableFormattingContext::DetermineRowHeights(TrackBoxList& rows, BoxList& ce
 				// If both the row and the cell heights are 'auto', we need to format the cell to get its height.
 				if (box.GetSize().y < 0)
 				{
-					FormattingContext::FormatIndependent(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
+					FormattingContext::FormatIndependentCached(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
 					box.SetContent(element_cell->GetBox().GetSize());
 				}
 
@@ -400,7 +400,7 @@ void TableFormattingContext::FormatCells(BoxList& cells, Vector2f& table_overflo
 			if (is_aligned)
 			{
 				// We need to format the cell to know how much padding to add.
-				FormattingContext::FormatIndependent(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
+				FormattingContext::FormatIndependentCached(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
 				box.SetContent(element_cell->GetBox().GetSize());
 			}
 			else
@@ -444,16 +444,17 @@ void TableFormattingContext::FormatCells(BoxList& cells, Vector2f& table_overflo
 		// @performance: We may have already formatted the element during the above procedures without the extra padding. In that case, we may
 		//   instead set the new box and offset all descending elements whose offset parent is the cell, to account for the new padding box.
 		//   That should be faster than formatting the element again, but there may be edge-cases not accounted for.
-		auto cell_box = FormattingContext::FormatIndependent(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
-		Vector2f cell_visible_overflow_size = cell_box->GetVisibleOverflowSize();
+		const FormattingResults cell_results =
+			FormattingContext::FormatIndependentCached(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
+		Vector2f cell_visible_overflow_size = cell_results.visible_overflow_size;
 
 		// Set the position of the element within the table container
 		element_cell->SetOffset(cell_offset, element_table);
 
 		// The table baseline is simply set to the first cell that has a baseline.
-		if (!baseline_set && cell_box->GetBaselineOfLastLine(table_baseline))
+		if (!baseline_set && cell_results.has_baseline_of_last_line)
 		{
-			table_baseline += cell_offset.y;
+			table_baseline = cell_results.baseline_of_last_line + cell_offset.y;
 			baseline_set = true;
 		}
 
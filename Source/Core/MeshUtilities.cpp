@@ -48,6 +48,41 @@ void MeshUtilities::GenerateQuad(Mesh& mesh, Vector2f origin, Vector2f dimension
 	indices[i0 + 5] = v0 + 2;
 }
 
+static ColourbPremultiplied GetGlyphColour(const TexturedGlyphs& glyphs, const GlyphInstance& glyph, ColourbPremultiplied text_colour, float opacity)
+{
+	if (!glyphs.text_colour)
+		return glyphs.effect_colour.ToPremultiplied(opacity);
+	if (glyph.coloured_glyph)
+		return ColourbPremultiplied(text_colour.alpha, text_colour.alpha);
+	return text_colour;
+}
+
+void MeshUtilities::GenerateGlyphs(Mesh& mesh, const TexturedGlyphs& glyphs, ColourbPremultiplied text_colour, float opacity)
+{
+	mesh.vertices.reserve(mesh.vertices.size() + 4 * glyphs.glyphs.size());
+	mesh.indices.reserve(mesh.indices.size() + 6 * glyphs.glyphs.size());
+
+	for (const GlyphInstance& glyph : glyphs.glyphs)
+	{
+		GenerateQuad(mesh, glyph.position, glyph.dimensions, GetGlyphColour(glyphs, glyph, text_colour, opacity), glyph.top_left_texcoord,
+			glyph.bottom_right_texcoord);
+	}
+}
+
+void MeshUtilities::SetGlyphColours(Mesh& mesh, const TexturedGlyphs& glyphs, ColourbPremultiplied text_colour, float opacity)
+{
+	RMLUI_ASSERT(mesh.vertices.size() >= 4 * glyphs.glyphs.size());
+
+	Vertex* vertices = mesh.vertices.data();
+	for (const GlyphInstance& glyph : glyphs.glyphs)
+	{
+		const ColourbPremultiplied colour = GetGlyphColour(glyphs, glyph, text_colour, opacity);
+		for (int i = 0; i < 4; i++)
+			vertices[i].colour = colour;
+		vertices += 4;
+	}
+}
+
 void MeshUtilities::GenerateLine(Mesh& mesh, Vector2f position, Vector2f size, ColourbPremultiplied color)
 {
 	Math::SnapToPixelGrid(position, size);
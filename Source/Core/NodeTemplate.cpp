@@ -0,0 +1,114 @@
+#include "NodeTemplate.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "XMLParseTools.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Records the nodes instead of handling them, while parsing with the same settings as the RML parser.
+class NodeTemplateRecorder final : public XMLParser {
+public:
+	NodeTemplateRecorder(Vector<NodeTemplate::Node>& nodes) : XMLParser(nullptr), nodes(nodes) {}
+
+	// Returns false if the nodes can not be replayed as they were parsed.
+	bool IsValid() const { return valid && open_tags.empty(); }
+
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		// The head handler expects to be parsing a document source.
+		if (StringUtilities::ToLower(name) == "head")
+			valid = false;
+
+		open_tags.push_back(name);
+		nodes.push_back(NodeTemplate::Node{NodeTemplate::NodeType::ElementStart, name, attributes});
+	}
+
+	void HandleElementEnd(const String& name) override
+	{
+		// Mismatched tags are reported against the source URL, which we don't have when instancing.
+		if (open_tags.empty() || open_tags.back() != name)
+			valid = false;
+		else
+			open_tags.pop_back();
+
+		nodes.push_back(NodeTemplate::Node{NodeTemplate::NodeType::ElementEnd, name, {}});
+	}
+
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		nodes.push_back(NodeTemplate::Node{NodeTemplate::NodeType::Data, data, {}, type});
+	}
+
+private:
+	Vector<NodeTemplate::Node>& nodes;
+	StringList open_tags;
+	bool valid = true;
+};
+
+bool NodeTemplate::Load(const String& rml, const String& base_tag)
+{
+	nodes.clear();
+
+	if (std::all_of(rml.begin(), rml.end(), &StringUtilities::IsWhitespace))
+		return true;
+
+	// Only contents with elements are run through the XML parser, see Factory::InstanceElementText. Plain text is cheap to instance as is.
+	bool has_elements = false;
+	bool inside_brackets = false;
+	bool inside_string = false;
+	char previous = 0;
+	for (const char c : rml)
+	{
+		if (XMLParseTools::ParseDataBrackets(inside_brackets, inside_string, c, previous))
+			return false;
+
+		if (!inside_brackets && c == '<')
+			has_elements = true;
+
+		previous = c;
+	}
+
+	if (!has_elements)
+		return false;
+
+	const String open_tag = "<" + base_tag + ">";
+	const String close_tag = "</" + base_tag + ">";
+
+	StreamMemory stream(rml.size() + open_tag.size() + close_tag.size());
+	stream.Write(open_tag.c_str(), open_tag.size());
+	stream.Write(rml);
+	stream.Write(close_tag.c_str(), close_tag.size());
+	stream.Seek(0, SEEK_SET);
+
+	NodeTemplateRecorder recorder(nodes);
+	recorder.Parse(&stream);
+
+	if (!recorder.IsValid())
+	{
+		nodes.clear();
+		return false;
+	}
+
+	return true;
+}
+
+void NodeTemplate::Instance(Element* parent) const
+{
+	XMLParser parser(parent);
+
+	// Call the handlers through the base class, where they are all public.
+	BaseXMLParser& base_parser = parser;
+
+	for (const Node& node : nodes)
+	{
+		switch (node.type)
+		{
+		case NodeType::ElementStart: base_parser.HandleElementStart(node.value, node.attributes); break;
+		case NodeType::ElementEnd: base_parser.HandleElementEnd(node.value); break;
+		case NodeType::Data: base_parser.HandleData(node.value, node.data_type); break;
+		}
+	}
+}
+
+} // namespace Rml
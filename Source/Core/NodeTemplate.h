@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+    Contains RML contents in pre-parsed form, as the sequence of nodes reported by the XML parser.
+
+    Instancing the template replays the nodes through the node handlers, just like parsing the RML would, but without tokenizing the RML again.
+    Useful when the same contents are instanced many times, such as for the elements generated by data-for views.
+ */
+
+class NodeTemplate {
+public:
+	/// Parse the given RML, in the same way as Element::SetInnerRML would.
+	/// @param[in] rml The RML contents, already translated by the system interface. The translation may change, thus it is not cached here.
+	/// @param[in] base_tag The tag to wrap the contents in, usually the documents base tag of the context.
+	/// @return False if the contents are not suitable for a template, they should instead be set on each element using SetInnerRML.
+	bool Load(const String& rml, const String& base_tag);
+
+	/// Instance the contents as children of the given element.
+	void Instance(Element* parent) const;
+
+private:
+	enum class NodeType { ElementStart, ElementEnd, Data };
+
+	struct Node {
+		NodeType type;
+		String value;
+		XMLAttributes attributes;
+		XMLDataType data_type = XMLDataType::Text;
+	};
+
+	Vector<Node> nodes;
+
+	friend class NodeTemplateRecorder;
+};
+
+} // namespace Rml
@@ -4,7 +4,9 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
 #include "TextureDatabase.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -38,6 +40,12 @@ RenderManager::~RenderManager()
 		}
 	}
 
+	for (auto& pair : batch_cache)
+	{
+		if (pair.second.handle)
+			ReleaseGeometry(pair.second.handle);
+	}
+
 	ReleaseAllTextures();
 }
 
@@ -51,6 +59,9 @@ void RenderManager::PrepareRender(Vector2i dimensions)
 	RMLUI_ASSERTMSG(render_stack.empty(), "Unbalanced render stack detected, ensure every PushLayer call has a corresponding call to PopLayer.");
 #endif
 
+	if (!batch_cache.empty())
+		ReleaseUnusedBatches();
+
 	SetViewport(dimensions);
 }
 
@@ -97,15 +108,22 @@ void RenderManager::SetScissorRegion(Rectanglei new_region)
 	const bool old_scissor_enable = state.scissor_region.Valid();
 	const bool new_scissor_enable = new_region.Valid();
 
+	if (new_scissor_enable)
+		new_region = new_region.Intersect(Rectanglei::FromSize(viewport_dimensions));
+
+	if (new_scissor_enable != old_scissor_enable || (new_scissor_enable && new_region != state.scissor_region))
+		FlushBatch();
+
 	if (new_scissor_enable != old_scissor_enable)
+	{
 		render_interface->EnableScissorRegion(new_scissor_enable);
+		statistics.scissor_changes += 1;
+	}
 
-	if (new_scissor_enable)
+	if (new_scissor_enable && new_region != state.scissor_region)
 	{
-		new_region = new_region.Intersect(Rectanglei::FromSize(viewport_dimensions));
-
-		if (new_region != state.scissor_region)
-			render_interface->SetScissorRegion(new_region);
+		render_interface->SetScissorRegion(new_region);
+		statistics.scissor_changes += 1;
 	}
 
 	state.scissor_region = new_region;
@@ -148,15 +166,33 @@ void RenderManager::SetTransform(const Matrix4f* p_new_transform)
 
 	if (state.transform != new_transform)
 	{
+		FlushBatch();
 		render_interface->SetTransform(p_new_transform);
 		state.transform = new_transform;
+		statistics.transform_changes += 1;
 	}
 }
 
+void RenderManager::EnableGeometryBatching(bool enable)
+{
+	FlushBatch();
+	batching_enabled = enable;
+}
+
+RenderStatistics RenderManager::GetStatistics() const
+{
+	RenderStatistics result = statistics;
+	result.texture_uploads = texture_database->file_database.GetUploadCount() + texture_database->callback_database.GetUploadCount();
+	return result;
+}
+
 void RenderManager::ApplyClipMask(const ClipMaskGeometryList& clip_elements)
 {
+	FlushBatch();
+
 	const bool clip_mask_enabled = !clip_elements.empty();
 	render_interface->EnableClipMask(clip_mask_enabled);
+	statistics.clip_mask_changes += 1;
 
 	if (clip_mask_enabled)
 	{
@@ -187,11 +223,16 @@ void RenderManager::SetState(const RenderState& next)
 void RenderManager::ResetState()
 {
 	SetState(RenderState{});
+	FlushBatch();
 }
 
 StableVectorIndex RenderManager::InsertGeometry(Mesh&& mesh)
 {
-	return geometry_list.insert(GeometryData{std::move(mesh), CompiledGeometryHandle{}});
+	geometry_generation += 1;
+	GeometryData data;
+	data.mesh = std::move(mesh);
+	data.generation = geometry_generation;
+	return geometry_list.insert(std::move(data));
 }
 
 CompiledGeometryHandle RenderManager::GetCompiledGeometryHandle(StableVectorIndex index)
@@ -203,10 +244,7 @@ CompiledGeometryHandle RenderManager::GetCompiledGeometryHandle(StableVectorInde
 	if (!geometry.handle && !geometry.mesh.indices.empty())
 	{
 		RMLUI_ZoneScopedNC("CompileGeometry", 0x1E60D2);
-		geometry.handle = render_interface->CompileGeometry(geometry.mesh.vertices, geometry.mesh.indices);
-
-		if (!geometry.handle)
-			Log::Message(Log::LT_ERROR, "Got empty compiled geometry.");
+		geometry.handle = CompileGeometry(geometry.mesh);
 	}
 	return geometry.handle;
 }
@@ -222,20 +260,222 @@ void RenderManager::Render(const Geometry& geometry, Vector2f translation, Textu
 		return;
 	}
 
-	if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(geometry.resource_handle))
+	const GeometryData& geometry_data = geometry_list[geometry.resource_handle];
+	if (geometry_data.mesh.indices.empty())
+		return;
+
+	// Generating a callback texture may submit commands of its own, thus resolve the texture before recording the geometry.
+	TextureHandle texture_handle = {};
+	if (texture.file_index != TextureFileIndex::Invalid)
+		texture_handle = texture_database->file_database.GetHandle(render_interface, texture.file_index);
+	else if (texture.callback_index != StableVectorIndex::Invalid)
+		texture_handle = texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
+
+	if (!shader)
 	{
-		TextureHandle texture_handle = {};
-		if (texture.file_index != TextureFileIndex::Invalid)
-			texture_handle = texture_database->file_database.GetHandle(render_interface, texture.file_index);
-		else if (texture.callback_index != StableVectorIndex::Invalid)
-			texture_handle = texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
+		if (!batch_entries.empty() && batch_texture != texture_handle)
+			FlushBatch();
+
+		batch_texture = texture_handle;
+		batch_entries.push_back(BatchEntry{geometry.resource_handle, geometry_data.generation, translation});
+
+		if (!batching_enabled)
+			FlushBatch();
+		return;
+	}
+
+	FlushBatch();
 
+	if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(geometry.resource_handle))
+	{
 		RMLUI_ZoneScopedNC("RenderGeometry", 0x3E60B2);
-		if (shader)
-			render_interface->RenderShader(shader.resource_handle, geometry_handle, translation, texture_handle);
-		else
-			render_interface->RenderGeometry(geometry_handle, translation, texture_handle);
+		render_interface->RenderShader(shader.resource_handle, geometry_handle, translation, texture_handle);
+		statistics.draw_calls += 1;
+	}
+}
+
+void RenderManager::FlushBatch()
+{
+	if (batch_entries.empty())
+		return;
+
+	RMLUI_ZoneScopedNC("RenderGeometry", 0x3E60B2);
+
+	// Split the recorded geometry where it changed or moved relative to its neighbors since it was last recorded. Geometry that changes every
+	// frame, such as during animations, is then rendered separately, while the merged geometry around it is retained.
+	auto is_unchanged_neighbor = [this](const BatchEntry& previous, const BatchEntry& next) {
+		const GeometryData& previous_data = geometry_list[previous.index];
+		const GeometryData& next_data = geometry_list[next.index];
+		return previous_data.recorded_generation == previous.generation && next_data.recorded_generation == next.generation &&
+			previous.translation - previous_data.recorded_translation == next.translation - next_data.recorded_translation;
+	};
+
+	size_t begin = 0;
+	for (size_t i = 1; i <= batch_entries.size(); i++)
+	{
+		if (i == batch_entries.size() || !is_unchanged_neighbor(batch_entries[i - 1], batch_entries[i]))
+		{
+			RenderBatch(begin, i);
+			begin = i;
+		}
+	}
+
+	for (const BatchEntry& entry : batch_entries)
+	{
+		GeometryData& data = geometry_list[entry.index];
+		data.recorded_generation = entry.generation;
+		data.recorded_translation = entry.translation;
 	}
+
+	batch_entries.clear();
+}
+
+void RenderManager::RenderBatch(size_t begin, size_t end)
+{
+	const BatchEntry& first = batch_entries[begin];
+
+	if (end - begin == 1)
+	{
+		if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(first.index))
+		{
+			render_interface->RenderGeometry(geometry_handle, first.translation, batch_texture);
+			statistics.draw_calls += 1;
+		}
+		return;
+	}
+
+	// Reuse the merged geometry if the same sequence of geometry was rendered before, only the batch as a whole may have moved.
+	size_t hash = 0;
+	for (size_t i = begin; i < end; i++)
+	{
+		const BatchEntry& entry = batch_entries[i];
+		const Vector2f offset = entry.translation - first.translation;
+		Utilities::HashCombine(hash, (uint32_t)entry.index);
+		Utilities::HashCombine(hash, entry.generation);
+		Utilities::HashCombine(hash, offset.x);
+		Utilities::HashCombine(hash, offset.y);
+	}
+
+	GeometryBatch& batch = batch_cache[hash];
+	batch.last_used_frame = batch_frame;
+
+	bool matches_cache = (batch.handle && batch.entries.size() == end - begin);
+	for (size_t i = 0; matches_cache && i < batch.entries.size(); i++)
+	{
+		const BatchEntry& a = batch.entries[i];
+		const BatchEntry& b = batch_entries[begin + i];
+		matches_cache = (a.index == b.index && a.generation == b.generation && a.translation == b.translation - first.translation);
+	}
+
+	if (!matches_cache)
+	{
+		RMLUI_ZoneScopedNC("CompileGeometry", 0x1E60D2);
+
+		size_t num_vertices = 0, num_indices = 0;
+		for (size_t i = begin; i < end; i++)
+		{
+			const Mesh& mesh = geometry_list[batch_entries[i].index].mesh;
+			num_vertices += mesh.vertices.size();
+			num_indices += mesh.indices.size();
+		}
+
+		// Merge into the buffers of a previous mesh to avoid allocations, the current mesh must remain intact while it is still compiled.
+		Mesh& merged_mesh = batch_mesh_buffer;
+		merged_mesh.vertices.clear();
+		merged_mesh.indices.clear();
+		merged_mesh.vertices.reserve(num_vertices);
+		merged_mesh.indices.reserve(num_indices);
+
+		batch.entries.clear();
+		for (size_t i = begin; i < end; i++)
+		{
+			const BatchEntry& entry = batch_entries[i];
+			const Vector2f offset = entry.translation - first.translation;
+			const Mesh& mesh = geometry_list[entry.index].mesh;
+			const int index_offset = (int)merged_mesh.vertices.size();
+
+			for (const Vertex& vertex : mesh.vertices)
+			{
+				merged_mesh.vertices.push_back(vertex);
+				merged_mesh.vertices.back().position += offset;
+			}
+			for (int index : mesh.indices)
+				merged_mesh.indices.push_back(index + index_offset);
+
+			batch.entries.push_back(BatchEntry{entry.index, entry.generation, offset});
+		}
+
+		std::swap(batch.mesh, merged_mesh);
+
+		if (!batch.handle || !UpdateGeometry(batch.handle, batch.mesh))
+		{
+			if (batch.handle)
+				ReleaseGeometry(batch.handle);
+
+			batch.handle = CompileGeometry(batch.mesh);
+		}
+	}
+
+	if (batch.handle)
+	{
+		render_interface->RenderGeometry(batch.handle, first.translation, batch_texture);
+		statistics.draw_calls += 1;
+	}
+}
+
+void RenderManager::ReleaseUnusedBatches()
+{
+	// Keep batches around for a few frames, in case they are rendered only every other frame, such as by multiple contexts.
+	constexpr int max_unused_frames = 4;
+
+	batch_frame += 1;
+	for (auto it = batch_cache.begin(); it != batch_cache.end();)
+	{
+		GeometryBatch& batch = it->second;
+		if (batch_frame - batch.last_used_frame <= max_unused_frames)
+		{
+			++it;
+			continue;
+		}
+
+		if (batch.handle)
+			ReleaseGeometry(batch.handle);
+
+		// Keep the largest buffers around for merging later batches.
+		if (batch.mesh.vertices.capacity() > batch_mesh_buffer.vertices.capacity())
+			batch_mesh_buffer = std::move(batch.mesh);
+
+		it = batch_cache.erase(it);
+	}
+}
+
+CompiledGeometryHandle RenderManager::CompileGeometry(const Mesh& mesh)
+{
+	const CompiledGeometryHandle handle = render_interface->CompileGeometry(mesh.vertices, mesh.indices);
+	if (!handle)
+		Log::Message(Log::LT_ERROR, "Got empty compiled geometry.");
+
+	statistics.geometry_compiled += 1;
+	statistics.vertex_bytes_uploaded += mesh.vertices.size() * sizeof(Vertex);
+	statistics.index_bytes_uploaded += mesh.indices.size() * sizeof(int);
+	return handle;
+}
+
+bool RenderManager::UpdateGeometry(CompiledGeometryHandle handle, const Mesh& mesh)
+{
+	if (!render_interface->UpdateGeometry(handle, mesh.vertices, mesh.indices))
+		return false;
+
+	statistics.geometry_updated += 1;
+	statistics.vertex_bytes_uploaded += mesh.vertices.size() * sizeof(Vertex);
+	statistics.index_bytes_uploaded += mesh.indices.size() * sizeof(int);
+	return true;
+}
+
+void RenderManager::ReleaseGeometry(CompiledGeometryHandle handle)
+{
+	render_interface->ReleaseGeometry(handle);
+	statistics.geometry_released += 1;
 }
 
 void RenderManager::GetTextureSourceList(StringList& source_list) const
@@ -249,23 +489,57 @@ const Mesh& RenderManager::GetMesh(const Geometry& geometry) const
 	return geometry_list[geometry.resource_handle].mesh;
 }
 
+void RenderManager::UpdateMesh(const Geometry& geometry, Mesh&& mesh)
+{
+	RMLUI_ASSERT(geometry.render_manager == this && geometry.resource_handle != geometry.InvalidHandle());
+	RMLUI_ZoneScopedNC("UpdateGeometry", 0x1E60D2);
+
+	// Recorded geometry is only merged when submitted, thus it must be submitted before its mesh changes.
+	const StableVectorIndex index = geometry.resource_handle;
+	if (std::any_of(batch_entries.begin(), batch_entries.end(), [index](const BatchEntry& entry) { return entry.index == index; }))
+		FlushBatch();
+
+	// A new generation makes sure any merged batches containing this geometry are merged again.
+	GeometryData& data = geometry_list[index];
+	data.mesh = std::move(mesh);
+	geometry_generation += 1;
+	data.generation = geometry_generation;
+
+	if (data.handle && !UpdateGeometry(data.handle, data.mesh))
+	{
+		ReleaseGeometry(data.handle);
+		data.handle = {};
+	}
+}
+
 bool RenderManager::ReleaseTexture(const String& texture_source)
 {
+	FlushBatch();
 	return texture_database->file_database.ReleaseTexture(render_interface, texture_source);
 }
 
 void RenderManager::ReleaseAllTextures()
 {
+	FlushBatch();
 	texture_database->callback_database.ReleaseAllTextures(render_interface);
 	texture_database->file_database.ReleaseAllTextures(render_interface);
 }
 
 void RenderManager::ReleaseAllCompiledGeometry()
 {
+	FlushBatch();
+
+	for (auto& pair : batch_cache)
+	{
+		if (pair.second.handle)
+			ReleaseGeometry(pair.second.handle);
+	}
+	batch_cache.clear();
+
 	geometry_list.for_each([this](GeometryData& data) {
 		if (data.handle)
 		{
-			render_interface->ReleaseGeometry(data.handle);
+			ReleaseGeometry(data.handle);
 			data.handle = {};
 		}
 	});
@@ -276,6 +550,7 @@ CompiledFilter RenderManager::CompileFilter(const String& name, const Dictionary
 	if (CompiledFilterHandle handle = render_interface->CompileFilter(name, parameters))
 	{
 		compiled_filter_count += 1;
+		statistics.filters_compiled += 1;
 		return CompiledFilter(this, handle);
 	}
 
@@ -287,6 +562,7 @@ CompiledShader RenderManager::CompileShader(const String& name, const Dictionary
 	if (CompiledShaderHandle handle = render_interface->CompileShader(name, parameters))
 	{
 		compiled_shader_count += 1;
+		statistics.shaders_compiled += 1;
 		return CompiledShader(this, handle);
 	}
 
@@ -295,8 +571,10 @@ CompiledShader RenderManager::CompileShader(const String& name, const Dictionary
 
 LayerHandle RenderManager::PushLayer()
 {
+	FlushBatch();
 	const LayerHandle layer = render_interface->PushLayer();
 	render_stack.push_back(layer);
+	statistics.layers_pushed += 1;
 	return layer;
 }
 
@@ -304,12 +582,14 @@ void RenderManager::CompositeLayers(LayerHandle source, LayerHandle destination,
 {
 	RMLUI_ASSERT(source == 0 || std::find(render_stack.begin(), render_stack.end(), source) != render_stack.end());
 	RMLUI_ASSERT(destination == 0 || std::find(render_stack.begin(), render_stack.end(), destination) != render_stack.end());
+	FlushBatch();
 	render_interface->CompositeLayers(source, destination, blend_mode, filters);
 }
 
 void RenderManager::PopLayer()
 {
 	RMLUI_ASSERT(!render_stack.empty());
+	FlushBatch();
 	render_interface->PopLayer();
 	render_stack.pop_back();
 }
@@ -327,6 +607,7 @@ LayerHandle RenderManager::GetNextLayer() const
 
 CompiledFilter RenderManager::SaveLayerAsMaskImage()
 {
+	FlushBatch();
 	if (CompiledFilterHandle handle = render_interface->SaveLayerAsMaskImage())
 	{
 		compiled_filter_count += 1;
@@ -339,6 +620,7 @@ void RenderManager::ReleaseResource(const CallbackTexture& texture)
 {
 	RMLUI_ASSERT(texture.render_manager == this && texture.resource_handle != texture.InvalidHandle());
 
+	FlushBatch();
 	texture_database->callback_database.ReleaseTexture(render_interface, texture.resource_handle);
 }
 
@@ -347,9 +629,14 @@ Mesh RenderManager::ReleaseResource(const Geometry& geometry)
 	RMLUI_ASSERT(geometry.render_manager == this && geometry.resource_handle != geometry.InvalidHandle());
 	RMLUI_ZoneScopedNC("ReleaseGeometry", 0x1E60D2);
 
+	// Geometry is commonly regenerated during rendering, only submit the recorded geometry if it refers to this one.
+	const StableVectorIndex index = geometry.resource_handle;
+	if (std::any_of(batch_entries.begin(), batch_entries.end(), [index](const BatchEntry& entry) { return entry.index == index; }))
+		FlushBatch();
+
 	GeometryData data = geometry_list.erase(geometry.resource_handle);
 	if (data.handle)
-		render_interface->ReleaseGeometry(data.handle);
+		ReleaseGeometry(data.handle);
 	return std::move(data.mesh);
 }
 
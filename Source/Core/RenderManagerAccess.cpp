@@ -14,6 +14,18 @@ Vector2i RenderManagerAccess::GetDimensions(RenderManager* render_manager, Stabl
 	return render_manager->texture_database->callback_database.GetDimensions(render_manager, render_manager->render_interface, callback_texture);
 }
 
+void RenderManagerAccess::UpdateTextureRegion(RenderManager* render_manager, StableVectorIndex callback_texture, Span<const byte> source,
+	Rectanglei region)
+{
+	render_manager->FlushBatch();
+	render_manager->texture_database->callback_database.UpdateRegion(render_manager->render_interface, callback_texture, source, region);
+}
+
+bool RenderManagerAccess::IsTextureGenerated(RenderManager* render_manager, StableVectorIndex callback_texture)
+{
+	return render_manager->texture_database->callback_database.IsGenerated(callback_texture);
+}
+
 void RenderManagerAccess::Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture,
 	const CompiledShader& shader)
 {
@@ -30,6 +42,11 @@ const Mesh& RenderManagerAccess::GetMesh(RenderManager* render_manager, const Ge
 	return render_manager->GetMesh(geometry);
 }
 
+void RenderManagerAccess::UpdateMesh(RenderManager* render_manager, const Geometry& geometry, Mesh&& mesh)
+{
+	render_manager->UpdateMesh(geometry, std::move(mesh));
+}
+
 bool RenderManagerAccess::ReleaseTexture(RenderManager* render_manager, const String& texture_source)
 {
 	return render_manager->ReleaseTexture(texture_source);
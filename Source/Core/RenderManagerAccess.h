@@ -22,11 +22,14 @@ private:
 
 	static Vector2i GetDimensions(RenderManager* render_manager, TextureFileIndex texture);
 	static Vector2i GetDimensions(RenderManager* render_manager, StableVectorIndex callback_texture);
+	static void UpdateTextureRegion(RenderManager* render_manager, StableVectorIndex callback_texture, Span<const byte> source, Rectanglei region);
+	static bool IsTextureGenerated(RenderManager* render_manager, StableVectorIndex callback_texture);
 
 	static void Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
 
 	static void GetTextureSourceList(RenderManager* render_manager, StringList& source_list);
 	static const Mesh& GetMesh(RenderManager* render_manager, const Geometry& geometry);
+	static void UpdateMesh(RenderManager* render_manager, const Geometry& geometry, Mesh&& mesh);
 
 	static bool ReleaseTexture(RenderManager* render_manager, const String& texture_source);
 	static void ReleaseAllTextures(RenderManager* render_manager);
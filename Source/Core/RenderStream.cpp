@@ -0,0 +1,372 @@
+#include "../../Include/RmlUi/Core/RenderStream.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+
+namespace Rml {
+
+RenderStreamRecorder::RenderStreamRecorder(RenderInterface* render_interface) : render_interface(render_interface)
+{
+	RMLUI_ASSERT(render_interface);
+}
+
+RenderStreamRecorder::~RenderStreamRecorder() {}
+
+RenderStreamFrame RenderStreamRecorder::TakeFrame()
+{
+	RenderStreamFrame result = std::move(frame);
+	frame = RenderStreamFrame();
+	return result;
+}
+
+CompiledGeometryHandle RenderStreamRecorder::CompileGeometry(Span<const Vertex> vertices, Span<const int> indices)
+{
+	Command& command = AddCommand(CommandType::CompileGeometry, NewHandle());
+	command.offset = (int)frame.meshes.size();
+	frame.meshes.push_back(Mesh{Vector<Vertex>(vertices.begin(), vertices.end()), Vector<int>(indices.begin(), indices.end())});
+	return command.handles[0];
+}
+
+void RenderStreamRecorder::RenderGeometry(CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture)
+{
+	Command& command = AddCommand(CommandType::RenderGeometry, geometry);
+	command.handles[1] = texture;
+	command.translation = translation;
+}
+
+void RenderStreamRecorder::ReleaseGeometry(CompiledGeometryHandle geometry)
+{
+	AddCommand(CommandType::ReleaseGeometry, geometry);
+}
+
+bool RenderStreamRecorder::UpdateGeometry(CompiledGeometryHandle geometry, Span<const Vertex> vertices, Span<const int> indices)
+{
+	Command& command = AddCommand(CommandType::UpdateGeometry, geometry);
+	command.offset = (int)frame.meshes.size();
+	frame.meshes.push_back(Mesh{Vector<Vertex>(vertices.begin(), vertices.end()), Vector<int>(indices.begin(), indices.end())});
+	return true;
+}
+
+TextureHandle RenderStreamRecorder::LoadTexture(Vector2i& texture_dimensions, const String& source)
+{
+	const TextureHandle texture = render_interface->LoadTexture(texture_dimensions, source);
+	if (!texture)
+		return {};
+
+	Command& command = AddCommand(CommandType::LoadTexture, NewHandle());
+	command.handles[1] = texture;
+	return command.handles[0];
+}
+
+TextureHandle RenderStreamRecorder::GenerateTexture(Span<const byte> source, Vector2i source_dimensions)
+{
+	Command& command = AddCommand(CommandType::GenerateTexture, NewHandle());
+	command.offset = (int)frame.texture_data.size();
+	command.count = (int)source.size();
+	command.region = Rectanglei::FromSize(source_dimensions);
+	frame.texture_data.insert(frame.texture_data.end(), source.begin(), source.end());
+	return command.handles[0];
+}
+
+void RenderStreamRecorder::ReleaseTexture(TextureHandle texture)
+{
+	AddCommand(CommandType::ReleaseTexture, texture);
+}
+
+void RenderStreamRecorder::EnableScissorRegion(bool enable)
+{
+	AddCommand(CommandType::EnableScissorRegion).value = enable;
+}
+
+void RenderStreamRecorder::SetScissorRegion(Rectanglei region)
+{
+	AddCommand(CommandType::SetScissorRegion).region = region;
+}
+
+void RenderStreamRecorder::EnableClipMask(bool enable)
+{
+	AddCommand(CommandType::EnableClipMask).value = enable;
+}
+
+void RenderStreamRecorder::RenderToClipMask(ClipMaskOperation operation, CompiledGeometryHandle geometry, Vector2f translation)
+{
+	Command& command = AddCommand(CommandType::RenderToClipMask, geometry);
+	command.value = (int)operation;
+	command.translation = translation;
+}
+
+void RenderStreamRecorder::SetTransform(const Matrix4f* transform)
+{
+	Command& command = AddCommand(CommandType::SetTransform);
+	command.offset = -1;
+	if (transform)
+	{
+		command.offset = (int)frame.transforms.size();
+		frame.transforms.push_back(*transform);
+	}
+}
+
+LayerHandle RenderStreamRecorder::PushLayer()
+{
+	return AddCommand(CommandType::PushLayer, NewHandle()).handles[0];
+}
+
+void RenderStreamRecorder::CompositeLayers(LayerHandle source, LayerHandle destination, BlendMode blend_mode,
+	Span<const CompiledFilterHandle> filters)
+{
+	Command& command = AddCommand(CommandType::CompositeLayers, source);
+	command.handles[1] = destination;
+	command.value = (int)blend_mode;
+	command.offset = (int)frame.filters.size();
+	command.count = (int)filters.size();
+	frame.filters.insert(frame.filters.end(), filters.begin(), filters.end());
+}
+
+void RenderStreamRecorder::PopLayer()
+{
+	AddCommand(CommandType::PopLayer);
+}
+
+TextureHandle RenderStreamRecorder::SaveLayerAsTexture()
+{
+	return AddCommand(CommandType::SaveLayerAsTexture, NewHandle()).handles[0];
+}
+
+CompiledFilterHandle RenderStreamRecorder::SaveLayerAsMaskImage()
+{
+	return AddCommand(CommandType::SaveLayerAsMaskImage, NewHandle()).handles[0];
+}
+
+CompiledFilterHandle RenderStreamRecorder::CompileFilter(const String& name, const Dictionary& parameters)
+{
+	Command& command = AddCommand(CommandType::CompileFilter, NewHandle());
+	command.offset = (int)frame.effects.size();
+	frame.effects.push_back(RenderStreamFrame::Effect{name, parameters});
+	return command.handles[0];
+}
+
+void RenderStreamRecorder::ReleaseFilter(CompiledFilterHandle filter)
+{
+	AddCommand(CommandType::ReleaseFilter, filter);
+}
+
+CompiledShaderHandle RenderStreamRecorder::CompileShader(const String& name, const Dictionary& parameters)
+{
+	Command& command = AddCommand(CommandType::CompileShader, NewHandle());
+	command.offset = (int)frame.effects.size();
+	frame.effects.push_back(RenderStreamFrame::Effect{name, parameters});
+	return command.handles[0];
+}
+
+void RenderStreamRecorder::RenderShader(CompiledShaderHandle shader, CompiledGeometryHandle geometry, Vector2f translation, TextureHandle texture)
+{
+	Command& command = AddCommand(CommandType::RenderShader, shader);
+	command.handles[1] = geometry;
+	command.handles[2] = texture;
+	command.translation = translation;
+}
+
+void RenderStreamRecorder::ReleaseShader(CompiledShaderHandle shader)
+{
+	AddCommand(CommandType::ReleaseShader, shader);
+}
+
+RenderStreamRecorder::Command& RenderStreamRecorder::AddCommand(CommandType type, uintptr_t handle)
+{
+	frame.commands.emplace_back();
+	Command& command = frame.commands.back();
+	command.type = type;
+	command.handles[0] = handle;
+	return command;
+}
+
+uintptr_t RenderStreamRecorder::NewHandle()
+{
+	return next_handle++;
+}
+
+RenderStreamPlayer::RenderStreamPlayer(RenderInterface* render_interface) : render_interface(render_interface)
+{
+	RMLUI_ASSERT(render_interface);
+}
+
+RenderStreamPlayer::~RenderStreamPlayer()
+{
+	RMLUI_ASSERTMSG(meshes.empty(), "Render stream player destroyed before all recorded geometry was released.");
+}
+
+void RenderStreamPlayer::Play(RenderStreamFrame frame)
+{
+	RMLUI_ZoneScoped;
+
+	using CommandType = RenderStreamFrame::CommandType;
+
+	for (const RenderStreamFrame::Command& command : frame.commands)
+	{
+		const uintptr_t handle = command.handles[0];
+
+		switch (command.type)
+		{
+		case CommandType::CompileGeometry:
+		{
+			// Move the mesh into its final location before compiling, so that the data remains valid until the geometry is released.
+			Mesh& mesh = meshes[handle];
+			mesh = std::move(frame.meshes[command.offset]);
+			handles[handle] = render_interface->CompileGeometry(mesh.vertices, mesh.indices);
+		}
+		break;
+		case CommandType::RenderGeometry:
+		{
+			if (const CompiledGeometryHandle geometry = Resolve(handle))
+				render_interface->RenderGeometry(geometry, command.translation, Resolve(command.handles[1]));
+		}
+		break;
+		case CommandType::ReleaseGeometry:
+		{
+			if (const CompiledGeometryHandle geometry = Resolve(handle))
+				render_interface->ReleaseGeometry(geometry);
+			handles.erase(handle);
+			meshes.erase(handle);
+		}
+		break;
+		case CommandType::UpdateGeometry:
+		{
+			// Moving the mesh keeps its data in place, thus the compiled geometry remains valid.
+			Mesh mesh = std::move(frame.meshes[command.offset]);
+			const CompiledGeometryHandle geometry = Resolve(handle);
+			if (!geometry || !render_interface->UpdateGeometry(geometry, mesh.vertices, mesh.indices))
+			{
+				handles[handle] = render_interface->CompileGeometry(mesh.vertices, mesh.indices);
+				if (geometry)
+					render_interface->ReleaseGeometry(geometry);
+			}
+			meshes[handle] = std::move(mesh);
+		}
+		break;
+		case CommandType::LoadTexture:
+		{
+			handles[handle] = command.handles[1];
+		}
+		break;
+		case CommandType::GenerateTexture:
+		{
+			const Span<const byte> source(frame.texture_data.data() + command.offset, (size_t)command.count);
+			handles[handle] = render_interface->GenerateTexture(source, command.region.Size());
+		}
+		break;
+		case CommandType::ReleaseTexture:
+		{
+			if (const TextureHandle texture = Resolve(handle))
+				render_interface->ReleaseTexture(texture);
+			handles.erase(handle);
+		}
+		break;
+		case CommandType::EnableScissorRegion:
+		{
+			render_interface->EnableScissorRegion(command.value != 0);
+		}
+		break;
+		case CommandType::SetScissorRegion:
+		{
+			render_interface->SetScissorRegion(command.region);
+		}
+		break;
+		case CommandType::EnableClipMask:
+		{
+			render_interface->EnableClipMask(command.value != 0);
+		}
+		break;
+		case CommandType::RenderToClipMask:
+		{
+			if (const CompiledGeometryHandle geometry = Resolve(handle))
+				render_interface->RenderToClipMask((ClipMaskOperation)command.value, geometry, command.translation);
+		}
+		break;
+		case CommandType::SetTransform:
+		{
+			render_interface->SetTransform(command.offset >= 0 ? &frame.transforms[command.offset] : nullptr);
+		}
+		break;
+		case CommandType::PushLayer:
+		{
+			handles[handle] = render_interface->PushLayer();
+			layers.push_back(handle);
+		}
+		break;
+		case CommandType::CompositeLayers:
+		{
+			filters.clear();
+			for (int i = 0; i < command.count; i++)
+				filters.push_back(Resolve(frame.filters[command.offset + i]));
+
+			render_interface->CompositeLayers(Resolve(handle), Resolve(command.handles[1]), (BlendMode)command.value, filters);
+		}
+		break;
+		case CommandType::PopLayer:
+		{
+			render_interface->PopLayer();
+
+			// Layer handles are only valid while the layer is on the stack.
+			if (!layers.empty())
+			{
+				handles.erase(layers.back());
+				layers.pop_back();
+			}
+		}
+		break;
+		case CommandType::SaveLayerAsTexture:
+		{
+			handles[handle] = render_interface->SaveLayerAsTexture();
+		}
+		break;
+		case CommandType::SaveLayerAsMaskImage:
+		{
+			handles[handle] = render_interface->SaveLayerAsMaskImage();
+		}
+		break;
+		case CommandType::CompileFilter:
+		{
+			const RenderStreamFrame::Effect& effect = frame.effects[command.offset];
+			handles[handle] = render_interface->CompileFilter(effect.name, effect.parameters);
+		}
+		break;
+		case CommandType::ReleaseFilter:
+		{
+			if (const CompiledFilterHandle filter = Resolve(handle))
+				render_interface->ReleaseFilter(filter);
+			handles.erase(handle);
+		}
+		break;
+		case CommandType::CompileShader:
+		{
+			const RenderStreamFrame::Effect& effect = frame.effects[command.offset];
+			handles[handle] = render_interface->CompileShader(effect.name, effect.parameters);
+		}
+		break;
+		case CommandType::RenderShader:
+		{
+			const CompiledShaderHandle shader = Resolve(handle);
+			const CompiledGeometryHandle geometry = Resolve(command.handles[1]);
+			if (shader && geometry)
+				render_interface->RenderShader(shader, geometry, command.translation, Resolve(command.handles[2]));
+		}
+		break;
+		case CommandType::ReleaseShader:
+		{
+			if (const CompiledShaderHandle shader = Resolve(handle))
+				render_interface->ReleaseShader(shader);
+			handles.erase(handle);
+		}
+		break;
+		}
+	}
+}
+
+uintptr_t RenderStreamPlayer::Resolve(uintptr_t recorded_handle) const
+{
+	if (!recorded_handle)
+		return {};
+
+	auto it = handles.find(recorded_handle);
+	return it != handles.end() ? it->second : uintptr_t{};
+}
+
+} // namespace Rml
@@ -5,6 +5,7 @@
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "ElementDefinition.h"
+#include "ElementDefinitionCache.h"
 #include "ElementStyle.h"
 #include "StyleSheetNode.h"
 #include <algorithm>
@@ -14,6 +15,7 @@ namespace Rml {
 StyleSheet::StyleSheet()
 {
 	root = MakeUnique<StyleSheetNode>();
+	node_cache = MakeUnique<ElementDefinitionCache>();
 	specificity_offset = 0;
 }
 
@@ -162,55 +164,107 @@ const Sprite* StyleSheet::GetSprite(const String& name) const
 	return spritesheet_list.GetSprite(name);
 }
 
-SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element) const
+// Returns true if two sibling elements are guaranteed to be matched by the same non-positional style sheet nodes.
+static bool HasEqualSelectorInputs(const Element* element, const Element* sibling, const StringList& attribute_names)
 {
-	RMLUI_ASSERT_NONRECURSIVE;
+	const ElementStyle* style = element->GetStyle();
+	const ElementStyle* sibling_style = sibling->GetStyle();
+
+	// Ids are unique by intent, so we don't bother sharing styles between them.
+	if (style->GetTagAtom() != sibling_style->GetTagAtom() || style->GetIdAtom() != Atom::Empty || sibling_style->GetIdAtom() != Atom::Empty)
+		return false;
+
+	if (style->GetClassNameList() != sibling_style->GetClassNameList())
+		return false;
+
+	const PseudoClassMap& pseudo_classes = style->GetActivePseudoClasses();
+	const PseudoClassMap& sibling_pseudo_classes = sibling_style->GetActivePseudoClasses();
+	if (pseudo_classes.size() != sibling_pseudo_classes.size())
+		return false;
+	for (const auto& pseudo_class : pseudo_classes)
+	{
+		if (sibling_pseudo_classes.count(pseudo_class.first) == 0)
+			return false;
+	}
+
+	for (const String& name : attribute_names)
+	{
+		const Variant* value = element->GetAttribute(name);
+		const Variant* sibling_value = sibling->GetAttribute(name);
+		if (value != sibling_value && (!value || !sibling_value || *value != *sibling_value))
+			return false;
+	}
+
+	return true;
+}
 
-	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector<const StyleSheetNode*> applicable_nodes;
+SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element) const
+{
+	// Using per-thread storage to avoid allocations, while allowing definitions to be resolved on multiple threads. Nothing below calls back into
+	// this function, thus the storage is never used by more than one call at a time.
+	static thread_local StyleSheetIndex::NodeList applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
+	// Text elements are never matched.
+	if (element->GetTagName() == "#text")
+		return nullptr;
+
+	// See if there are any styles defined for this element.
+	ElementStyle* style = element->GetStyle();
+	const Atom id = style->GetIdAtom();
+	const AtomList& class_names = style->GetClassNameList();
+
+	// Nodes with ancestor requirements that are definitely not met by the element's ancestors can be rejected without traversing the hierarchy.
+	const AncestorFilter& ancestor_filter = style->GetAncestorFilter();
+
+	// Repeated elements, such as rows in a list, are often styled exactly like their preceding sibling. Since they share the same ancestors, the
+	// sibling's definition can be reused when both have equal selector inputs, as long as no positional nodes are involved.
+	if (const Element* sibling = style->GetStyleSharingCandidate())
+	{
+		const SharedPtr<const ElementDefinition>& sibling_definition = sibling->GetStyle()->GetDefinition();
+		if ((!sibling_definition || !sibling_definition->IsPositional()) &&
+			HasEqualSelectorInputs(element, sibling, styled_node_index.attribute_names))
+		{
+			const bool any_positional_applicable =
+				std::any_of(styled_node_index.positional.begin(), styled_node_index.positional.end(), [&](const StyleSheetNode* node) {
+					return ancestor_filter.MayContainAll(node->GetAncestorRequirements()) && node->IsApplicable(element, nullptr);
+				});
+
+			if (!any_positional_applicable)
+				return sibling_definition;
+		}
+	}
+
+	auto AddApplicableNode = [element, &ancestor_filter](const StyleSheetNode* node) {
+		// See if we satisfy the remaining requirements of the node, including all ancestor nodes. What this involves is traversing the style nodes
+		// backwards, trying to match nodes in the element's hierarchy to nodes in the style hierarchy.
+		if (ancestor_filter.MayContainAll(node->GetAncestorRequirements()) && node->IsApplicable(element, nullptr))
+			applicable_nodes.push_back(node);
+	};
+
+	auto AddApplicableNodes = [&AddApplicableNode](const StyleSheetIndex::NodeIndex& node_index, Atom key) {
+		auto it_nodes = node_index.find(static_cast<size_t>(key));
 		if (it_nodes != node_index.end())
 		{
+			// We found nodes that have at least one requirement matching the element.
 			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
-
 			for (const StyleSheetNode* node : nodes)
-			{
-				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
-				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
-				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element, nullptr))
-					applicable_nodes.push_back(node);
-			}
+				AddApplicableNode(node);
 		}
 	};
 
-	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
-
-	// Text elements are never matched.
-	if (tag == "#text")
-		return nullptr;
-
 	// First, look up the indexed requirements.
-	if (!id.empty())
+	if (id != Atom::Empty)
 		AddApplicableNodes(styled_node_index.ids, id);
 
-	for (const String& name : class_names)
+	for (Atom name : class_names)
 		AddApplicableNodes(styled_node_index.classes, name);
 
-	AddApplicableNodes(styled_node_index.tags, tag);
+	AddApplicableNodes(styled_node_index.tags, style->GetTagAtom());
 
 	// Also check all remaining nodes that don't contain any indexed requirements.
 	for (const StyleSheetNode* node : styled_node_index.other)
-	{
-		if (node->IsApplicable(element, nullptr))
-			applicable_nodes.push_back(node);
-	}
+		AddApplicableNode(node);
 
 	// If this element definition won't actually store any information, don't bother with it.
 	if (applicable_nodes.empty())
@@ -225,15 +279,8 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 		return a_specificity < b_specificity;
 	});
 
-	// Check if this puppy has already been cached in the node index.
-	SharedPtr<const ElementDefinition>& definition = node_cache[applicable_nodes];
-	if (!definition)
-	{
-		// Otherwise, create a new definition and add it to our cache.
-		definition = MakeShared<const ElementDefinition>(applicable_nodes);
-	}
-
-	return definition;
+	// Check if this puppy has already been cached in the node index, otherwise create a new definition and add it to our cache.
+	return node_cache->GetOrCreate(applicable_nodes);
 }
 
 } // namespace Rml
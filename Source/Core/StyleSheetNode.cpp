@@ -2,6 +2,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
@@ -22,11 +23,13 @@ StyleSheetNode::StyleSheetNode()
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorRequirements();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorRequirements();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -101,8 +104,8 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	// If this has properties defined, then we insert it into the styled node index.
 	if (!properties.Empty())
 	{
-		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, const String& key, const StyleSheetNode* node) {
-			StyleSheetIndex::NodeList& nodes = node_index[Hash<String>()(key)];
+		auto IndexInsertNode = [](StyleSheetIndex::NodeIndex& node_index, Atom key, const StyleSheetNode* node) {
+			StyleSheetIndex::NodeList& nodes = node_index[static_cast<size_t>(key)];
 			auto it = std::find(nodes.begin(), nodes.end(), node);
 			if (it == nodes.end())
 				nodes.push_back(node);
@@ -110,7 +113,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 
 		// Add this node to the appropriate index for looking up applicable nodes later. Prioritize the most unique requirement first and the most
 		// general requirement last. This way we are able to rule out as many nodes as possible as quickly as possible.
-		if (!selector.id.empty())
+		if (selector.id != Atom::Empty)
 		{
 			IndexInsertNode(styled_node_index.ids, selector.id, this);
 		}
@@ -120,7 +123,7 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
 			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
 		}
-		else if (!selector.tag.empty())
+		else if (selector.tag != Atom::Empty)
 		{
 			IndexInsertNode(styled_node_index.tags, selector.tag, this);
 		}
@@ -128,6 +131,16 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 		{
 			styled_node_index.other.push_back(this);
 		}
+
+		if (IsPositional())
+			styled_node_index.positional.push_back(this);
+
+		for (const AttributeSelector& attribute : selector.attributes)
+		{
+			StringList& names = styled_node_index.attribute_names;
+			if (std::find(names.begin(), names.end(), attribute.name) == names.end())
+				names.push_back(attribute.name);
+		}
 	}
 
 	for (auto& child : children)
@@ -139,6 +152,12 @@ int StyleSheetNode::GetSpecificity() const
 	return specificity;
 }
 
+bool StyleSheetNode::IsPositional() const
+{
+	return !selector.structural_selectors.empty() || selector.combinator == SelectorCombinator::NextSibling ||
+		selector.combinator == SelectorCombinator::SubsequentSibling;
+}
+
 void StyleSheetNode::ImportProperties(const PropertyDictionary& _properties, int rule_specificity)
 {
 	properties.Import(_properties, specificity + rule_specificity);
@@ -151,21 +170,23 @@ const PropertyDictionary& StyleSheetNode::GetProperties() const
 
 bool StyleSheetNode::Match(const Element* element, const Element* scope) const
 {
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	const ElementStyle* style = element->GetStyle();
+
+	if (selector.tag != Atom::Empty && selector.tag != style->GetTagAtom())
 		return false;
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::Empty && selector.id != style->GetIdAtom())
 		return false;
 
-	for (auto& name : selector.class_names)
+	for (Atom name : selector.class_names)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(name))
 			return false;
 	}
 
-	for (auto& name : selector.pseudo_class_names)
+	for (Atom name : selector.pseudo_class_names)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(name))
 			return false;
 	}
 
@@ -334,22 +355,24 @@ bool StyleSheetNode::IsApplicable(const Element* element, const Element* scope)
 
 	// We could in principle just call Match() here and then go on with the ancestor style nodes. Instead, we test the requirements of this node in a
 	// particular order for performance reasons.
-	for (const String& name : selector.pseudo_class_names)
+	const ElementStyle* style = element->GetStyle();
+
+	for (Atom name : selector.pseudo_class_names)
 	{
-		if (!element->IsPseudoClassSet(name))
+		if (!style->IsPseudoClassSet(name))
 			return false;
 	}
 
-	if (!selector.tag.empty() && selector.tag != element->GetTagName())
+	if (selector.tag != Atom::Empty && selector.tag != style->GetTagAtom())
 		return false;
 
-	for (const String& name : selector.class_names)
+	for (Atom name : selector.class_names)
 	{
-		if (!element->IsClassSet(name))
+		if (!style->IsClassSet(name))
 			return false;
 	}
 
-	if (!selector.id.empty() && selector.id != element->GetId())
+	if (selector.id != Atom::Empty && selector.id != style->GetIdAtom())
 		return false;
 
 	if (!selector.attributes.empty() && !MatchAttributes(element))
@@ -371,10 +394,10 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 	// First calculate the specificity of this node alone.
 	specificity = 0;
 
-	if (!selector.tag.empty())
+	if (selector.tag != Atom::Empty)
 		specificity += SelectorSpecificity::Tag;
 
-	if (!selector.id.empty())
+	if (selector.id != Atom::Empty)
 		specificity += SelectorSpecificity::ID;
 
 	specificity += SelectorSpecificity::Class * (int)selector.class_names.size();
@@ -389,4 +412,23 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateAncestorRequirements()
+{
+	if (!parent)
+		return;
+
+	// Any ancestor of the element matched by our parent node is also an ancestor of our element, regardless of the combinator. With sibling
+	// combinators the parent node itself is matched by a sibling, otherwise it is matched by an ancestor and its names become requirements too.
+	ancestor_requirements = parent->ancestor_requirements;
+
+	if (selector.combinator == SelectorCombinator::Descendant || selector.combinator == SelectorCombinator::Child)
+	{
+		const CompoundSelector& parent_selector = parent->selector;
+		ancestor_requirements.Insert(parent_selector.tag);
+		ancestor_requirements.Insert(parent_selector.id);
+		for (Atom name : parent_selector.class_names)
+			ancestor_requirements.Insert(name);
+	}
+}
+
 } // namespace Rml
@@ -2,6 +2,7 @@
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
 #include "StyleSheetSelector.h"
 
 namespace Rml {
@@ -47,9 +48,15 @@ public:
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
+	/// Returns true if the applicability of this node depends on the position of the element among its siblings or on its children, through
+	/// structural selectors or sibling combinators. Otherwise, it only depends on the element's names, attributes, pseudo-classes, and ancestors.
+	bool IsPositional() const;
+	/// Returns a filter of the names that must be present among the ancestors of any element this node is applicable to.
+	const AncestorFilter& GetAncestorRequirements() const { return ancestor_requirements; }
 
 private:
 	void CalculateAndSetSpecificity();
+	void CalculateAncestorRequirements();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element, const Element* scope) const;
@@ -68,6 +75,9 @@ private:
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
 
+	// The tag, id, and class names required to be matched by ancestors of the element, as given by descendant and child combinators.
+	AncestorFilter ancestor_requirements;
+
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
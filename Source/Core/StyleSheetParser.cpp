@@ -1141,8 +1141,8 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 			{
 				switch (rule[start_index])
 				{
-				case '#': selector.id = ExtractUnescapedSelectorToken(rule, start_index + 1, end_index); break;
-				case '.': selector.class_names.push_back(ExtractUnescapedSelectorToken(rule, start_index + 1, end_index)); break;
+				case '#': selector.id = AtomTable::GetOrInsert(ExtractUnescapedSelectorToken(rule, start_index + 1, end_index)); break;
+				case '.': selector.class_names.push_back(AtomTable::GetOrInsert(ExtractUnescapedSelectorToken(rule, start_index + 1, end_index))); break;
 				case ':':
 				{
 					String pseudo_class_name = ExtractUnescapedSelectorToken(rule, start_index + 1, end_index);
@@ -1150,7 +1150,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					if (node_selector.type != StructuralSelectorType::Invalid)
 						selector.structural_selectors.push_back(node_selector);
 					else
-						selector.pseudo_class_names.push_back(std::move(pseudo_class_name));
+						selector.pseudo_class_names.push_back(AtomTable::GetOrInsert(pseudo_class_name));
 				}
 				break;
 				case '[':
@@ -1166,7 +1166,7 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, const S
 					selector.attributes.push_back(std::move(attribute));
 				}
 				break;
-				default: selector.tag = ExtractUnescapedSelectorToken(rule, start_index, end_index); break;
+				default: selector.tag = AtomTable::GetOrInsert(ExtractUnescapedSelectorToken(rule, start_index, end_index)); break;
 				}
 			}
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include "Atom.h"
 
 namespace Rml {
 
@@ -108,12 +109,14 @@ using StructuralSelectorList = Vector<StructuralSelector>;
     Compound selector contains all the basic selectors for a single node.
 
     Such as div#foo.bar:nth-child(2)
+
+    Names are stored as atoms so that they can be matched against elements by integer comparisons.
  */
 struct CompoundSelector {
-	String tag;
-	String id;
-	StringList class_names;
-	StringList pseudo_class_names;
+	Atom tag = Atom::Empty;
+	Atom id = Atom::Empty;
+	AtomList class_names;
+	AtomList pseudo_class_names;
 	AttributeSelectorList attributes;
 	StructuralSelectorList structural_selectors;
 	SelectorCombinator combinator = SelectorCombinator::Descendant; // Determines how to match with our parent node.
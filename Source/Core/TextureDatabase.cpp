@@ -43,6 +43,33 @@ TextureHandle CallbackTextureDatabase::GetHandle(RenderManager* render_manager,
 	return EnsureLoaded(render_manager, render_interface, callback_index).texture_handle;
 }
 
+void CallbackTextureDatabase::UpdateRegion(RenderInterface* render_interface, StableVectorIndex callback_index, Span<const byte> source,
+	Rectanglei region)
+{
+	CallbackTextureEntry& data = texture_list[callback_index];
+
+	// Textures not yet generated will include the update once they are.
+	if (!data.texture_handle)
+		return;
+
+	if (render_interface->UpdateTexture(data.texture_handle, source, region))
+	{
+		upload_count += 1;
+	}
+	else
+	{
+		// Not supported by the render interface, instead generate the whole texture again next time it is used.
+		render_interface->ReleaseTexture(data.texture_handle);
+		data.texture_handle = {};
+		data.dimensions = {};
+	}
+}
+
+bool CallbackTextureDatabase::IsGenerated(StableVectorIndex callback_index) const
+{
+	return texture_list[callback_index].texture_handle != TextureHandle{};
+}
+
 auto CallbackTextureDatabase::EnsureLoaded(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index)
 	-> CallbackTextureEntry&
 {
@@ -55,6 +82,10 @@ auto CallbackTextureDatabase::EnsureLoaded(RenderManager* render_manager, Render
 			data.texture_handle = {};
 			data.dimensions = {};
 		}
+		else if (data.texture_handle)
+		{
+			upload_count += 1;
+		}
 	}
 	return data;
 }
@@ -64,6 +95,11 @@ size_t CallbackTextureDatabase::size() const
 	return texture_list.size();
 }
 
+int CallbackTextureDatabase::GetUploadCount() const
+{
+	return upload_count;
+}
+
 void CallbackTextureDatabase::ReleaseAllTextures(RenderInterface* render_interface)
 {
 	texture_list.for_each([render_interface](CallbackTextureEntry& texture) {
@@ -107,7 +143,11 @@ FileTextureDatabase::FileTextureEntry FileTextureDatabase::LoadTextureEntry(Rend
 {
 	FileTextureEntry result = {};
 	result.texture_handle = render_interface->LoadTexture(result.dimensions, source);
-	if (!result.texture_handle)
+	if (result.texture_handle)
+	{
+		upload_count += 1;
+	}
+	else
 	{
 		result.load_texture_failed = true;
 		Rml::Log::Message(Rml::Log::LT_WARNING, "Could not load texture: %s", source.c_str());
@@ -148,6 +188,11 @@ void FileTextureDatabase::GetSourceList(StringList& source_list) const
 		source_list.push_back(texture.first);
 }
 
+int FileTextureDatabase::GetUploadCount() const
+{
+	return upload_count;
+}
+
 bool FileTextureDatabase::ReleaseTexture(RenderInterface* render_interface, const String& source)
 {
 	auto it = texture_map.find(source);
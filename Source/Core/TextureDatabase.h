@@ -19,7 +19,13 @@ public:
 	Vector2i GetDimensions(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 	TextureHandle GetHandle(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 
+	void UpdateRegion(RenderInterface* render_interface, StableVectorIndex callback_index, Span<const byte> source, Rectanglei region);
+	// Returns true if the texture currently holds a handle from the render interface, without invoking the callback.
+	bool IsGenerated(StableVectorIndex callback_index) const;
+
 	size_t size() const;
+	// Returns the number of textures generated and updated through the render interface.
+	int GetUploadCount() const;
 
 	void ReleaseAllTextures(RenderInterface* render_interface);
 
@@ -34,6 +40,7 @@ private:
 	CallbackTextureEntry& EnsureLoaded(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 
 	StableVector<CallbackTextureEntry> texture_list;
+	int upload_count = 0;
 };
 
 class FileTextureDatabase : NonCopyMoveable {
@@ -47,6 +54,8 @@ public:
 	Vector2i GetDimensions(RenderInterface* render_interface, TextureFileIndex index);
 
 	void GetSourceList(StringList& source_list) const;
+	// Returns the number of textures loaded through the render interface.
+	int GetUploadCount() const;
 
 	bool ReleaseTexture(RenderInterface* render_interface, const String& source);
 	void ReleaseAllTextures(RenderInterface* render_interface);
@@ -63,6 +72,7 @@ private:
 
 	Vector<FileTextureEntry> texture_list;
 	UnorderedMap<String, TextureFileIndex> texture_map; // key: source, value: index into 'texture_list'
+	int upload_count = 0;
 };
 
 class TextureDatabase {
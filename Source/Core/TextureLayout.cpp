@@ -47,7 +47,7 @@ int TextureLayout::GetNumTextures() const
 	return (int)textures.size();
 }
 
-bool TextureLayout::GenerateLayout(int max_texture_dimensions)
+bool TextureLayout::GenerateLayout(int max_texture_dimensions, bool reserve_free_space)
 {
 	// Sort the rectangles by height.
 	std::sort(rectangles.begin(), rectangles.end(), RectangleSort());
@@ -56,7 +56,7 @@ bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 	while (num_placed_rectangles != GetNumRectangles())
 	{
 		TextureLayoutTexture texture;
-		int texture_size = texture.Generate(*this, max_texture_dimensions);
+		int texture_size = texture.Generate(*this, max_texture_dimensions, reserve_free_space);
 		if (texture_size == 0)
 			return false;
 
@@ -67,4 +67,19 @@ bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 	return true;
 }
 
+int TextureLayout::InsertRectangle(int id, Vector2i dimensions)
+{
+	const int rectangle_index = GetNumRectangles();
+	rectangles.push_back(TextureLayoutRectangle(id, dimensions));
+
+	for (int i = 0; i < GetNumTextures(); i++)
+	{
+		if (textures[i].Place(*this, rectangle_index, i))
+			return rectangle_index;
+	}
+
+	rectangles.pop_back();
+	return -1;
+}
+
 } // namespace Rml
@@ -39,8 +39,15 @@ public:
 
 	/// Attempts to generate an efficient texture layout for the rectangles.
 	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
+	/// @param[in] reserve_free_space True to leave room in the textures for rectangles inserted later.
 	/// @return True if the layout was generated successfully, false if not.
-	bool GenerateLayout(int max_texture_dimensions);
+	bool GenerateLayout(int max_texture_dimensions, bool reserve_free_space = false);
+
+	/// Adds a rectangle to the generated layout, placing it in the free space of one of the textures without moving any other rectangles.
+	/// @param[in] id The id of the rectangle; used to identify the rectangle after it has been positioned.
+	/// @param[in] dimensions The dimensions of the rectangle.
+	/// @return The index of the new rectangle, or -1 if it did not fit in any texture, in which case the layout is left unchanged.
+	int InsertRectangle(int id, Vector2i dimensions);
 
 private:
 	using RectangleList = Vector<TextureLayoutRectangle>;
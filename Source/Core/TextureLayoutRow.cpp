@@ -3,16 +3,16 @@
 
 namespace Rml {
 
-TextureLayoutRow::TextureLayoutRow()
+TextureLayoutRow::TextureLayoutRow(int y) : y(y)
 {
+	width = 1;
 	height = 0;
 }
 
 TextureLayoutRow::~TextureLayoutRow() {}
 
-int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
+int TextureLayoutRow::Generate(TextureLayout& layout, int max_width)
 {
-	int width = 1;
 	int first_unplaced_index = 0;
 	int placed_rectangles = 0;
 
@@ -33,31 +33,46 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 		if (index == layout.GetNumRectangles())
 			return placed_rectangles;
 
-		TextureLayoutRectangle& rectangle = layout.GetRectangle(index);
-
-		// Increment the row height if necessary.
-		height = Math::Max(height, rectangle.GetDimensions().y);
-
-		// Add this glyph onto our list and mark it as placed.
-		rectangles.push_back(&rectangle);
-		rectangle.Place(layout.GetNumTextures(), Vector2i(width, y));
+		Place(layout, index, layout.GetNumTextures());
 		++placed_rectangles;
 
-		// Increment our width. An extra pixel is added on so the rectangles aren't pushed up
-		// against each other. This will avoid filtering artifacts.
-		if (rectangle.GetDimensions().x > 0)
-			width += rectangle.GetDimensions().x + 1;
-
 		first_unplaced_index = index + 1;
 	}
 
 	return placed_rectangles;
 }
 
-void TextureLayoutRow::Allocate(byte* texture_data, int stride)
+bool TextureLayoutRow::CanPlace(Vector2i dimensions, int max_width) const
+{
+	return width + dimensions.x + 1 <= max_width && dimensions.y <= height;
+}
+
+void TextureLayoutRow::Place(TextureLayout& layout, int rectangle_index, int texture_index)
+{
+	TextureLayoutRectangle& rectangle = layout.GetRectangle(rectangle_index);
+
+	// Increment the row height if necessary.
+	height = Math::Max(height, rectangle.GetDimensions().y);
+
+	// Add this glyph onto our list and mark it as placed.
+	rectangles.push_back(rectangle_index);
+	rectangle.Place(texture_index, Vector2i(width, y));
+
+	// Increment our width. An extra pixel is added on so the rectangles aren't pushed up
+	// against each other. This will avoid filtering artifacts.
+	if (rectangle.GetDimensions().x > 0)
+		width += rectangle.GetDimensions().x + 1;
+}
+
+void TextureLayoutRow::Allocate(TextureLayout& layout, byte* texture_data, int stride)
+{
+	for (int rectangle_index : rectangles)
+		layout.GetRectangle(rectangle_index).Allocate(texture_data, stride);
+}
+
+int TextureLayoutRow::GetY() const
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Allocate(texture_data, stride);
+	return y;
 }
 
 int TextureLayoutRow::GetHeight() const
@@ -65,10 +80,10 @@ int TextureLayoutRow::GetHeight() const
 	return height;
 }
 
-void TextureLayoutRow::Unplace()
+void TextureLayoutRow::Unplace(TextureLayout& layout)
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Unplace();
+	for (int rectangle_index : rectangles)
+		layout.GetRectangle(rectangle_index).Unplace();
 }
 
 } // namespace Rml
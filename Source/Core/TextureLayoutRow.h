@@ -12,33 +12,50 @@ class TextureLayout;
 
 class TextureLayoutRow {
 public:
-	TextureLayoutRow();
+	/// @param[in] y The y-coordinate of this row.
+	TextureLayoutRow(int y);
 	~TextureLayoutRow();
 
 	/// Attempts to position unplaced rectangles from the layout into this row.
 	/// @param[in] layout The layout to position rectangles from.
 	/// @param[in] width The maximum width of this row.
-	/// @param[in] y The y-coordinate of this row.
 	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int width, int y);
+	int Generate(TextureLayout& layout, int width);
+
+	/// Returns true if a rectangle of the given dimensions fits at the end of this row, without increasing the row's height.
+	/// @param[in] dimensions The dimensions of the rectangle.
+	/// @param[in] width The maximum width of this row.
+	bool CanPlace(Vector2i dimensions, int width) const;
+	/// Positions a single rectangle from the layout at the end of this row.
+	/// @param[in] layout The layout to position the rectangle from.
+	/// @param[in] rectangle_index The index of the rectangle within the layout.
+	/// @param[in] texture_index The index of the texture this row is placed on.
+	void Place(TextureLayout& layout, int rectangle_index, int texture_index);
 
 	/// Assigns allocated texture data to all rectangles in this row.
+	/// @param[in] layout The layout of the rectangles.
 	/// @param[in] texture_data The pointer to the beginning of the texture's data.
 	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	void Allocate(TextureLayout& layout, byte* texture_data, int stride);
 
+	/// Returns the y-coordinate of the row.
+	int GetY() const;
 	/// Returns the height of the row.
 	/// @return The row's height.
 	int GetHeight() const;
 
 	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+	/// @param[in] layout The layout of the rectangles.
+	void Unplace(TextureLayout& layout);
 
 private:
-	using RectangleList = Vector<TextureLayoutRectangle*>;
+	// Rectangles are stored by their index in the layout, since more rectangles may be added to the layout after the row is generated.
+	using RectangleIndexList = Vector<int>;
 
+	int y;
+	int width;
 	int height;
-	RectangleList rectangles;
+	RectangleIndexList rectangles;
 };
 
 } // namespace Rml
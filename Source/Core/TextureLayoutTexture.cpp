@@ -16,7 +16,7 @@ Vector2i TextureLayoutTexture::GetDimensions() const
 	return dimensions;
 }
 
-int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions)
+int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions, bool reserve_free_space)
 {
 	// Come up with an estimate for how big a texture we need. Calculate the total square pixels
 	// required by the remaining rectangles to place, square-root it to get the dimensions of the
@@ -38,6 +38,9 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 		}
 	}
 
+	if (reserve_free_space)
+		square_pixels *= 2;
+
 	int texture_width = int(Math::SquareRoot((float)square_pixels));
 
 	dimensions.y = Math::ToPowerOfTwo(texture_width);
@@ -57,8 +60,8 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 
 		while (num_placed_rectangles != unplaced_rectangles)
 		{
-			TextureLayoutRow row;
-			int row_size = row.Generate(layout, dimensions.x, height);
+			TextureLayoutRow row(height);
+			int row_size = row.Generate(layout, dimensions.x);
 			if (row_size == 0)
 			{
 				success = false;
@@ -69,7 +72,7 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 			if (height > dimensions.y)
 			{
 				// D'oh! We've exceeded our height boundaries. This row should be unplaced.
-				row.Unplace();
+				row.Unplace(layout);
 				success = false;
 				break;
 			}
@@ -97,14 +100,41 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 
 		// Unplace all of the glyphs we tried to place and have an other crack.
 		for (size_t i = 0; i < rows.size(); i++)
-			rows[i].Unplace();
+			rows[i].Unplace(layout);
 
 		rows.clear();
 		num_placed_rectangles = 0;
 	}
 }
 
-Vector<byte> TextureLayoutTexture::AllocateTexture()
+bool TextureLayoutTexture::Place(TextureLayout& layout, int rectangle_index, int texture_index)
+{
+	const Vector2i rectangle_dimensions = layout.GetRectangle(rectangle_index).GetDimensions();
+
+	// Look for the row with the least height to spare which has room left at its end.
+	TextureLayoutRow* best_row = nullptr;
+	for (TextureLayoutRow& row : rows)
+	{
+		if (row.CanPlace(rectangle_dimensions, dimensions.x) && (!best_row || row.GetHeight() < best_row->GetHeight()))
+			best_row = &row;
+	}
+
+	// Otherwise, start a new row below the existing ones if there is room.
+	if (!best_row)
+	{
+		const int y = (rows.empty() ? 1 : rows.back().GetY() + rows.back().GetHeight() + 1);
+		if (y + rectangle_dimensions.y + 1 > dimensions.y || rectangle_dimensions.x + 2 > dimensions.x)
+			return false;
+
+		rows.push_back(TextureLayoutRow(y));
+		best_row = &rows.back();
+	}
+
+	best_row->Place(layout, rectangle_index, texture_index);
+	return true;
+}
+
+Vector<byte> TextureLayoutTexture::AllocateTexture(TextureLayout& layout)
 {
 	Vector<byte> texture_data;
 
@@ -114,7 +144,7 @@ Vector<byte> TextureLayoutTexture::AllocateTexture()
 		texture_data.resize(dimensions.x * dimensions.y * 4, 0);
 
 		for (size_t i = 0; i < rows.size(); ++i)
-			rows[i].Allocate(texture_data.data(), dimensions.x * 4);
+			rows[i].Allocate(layout, texture_data.data(), dimensions.x * 4);
 	}
 
 	return texture_data;
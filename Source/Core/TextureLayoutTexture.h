@@ -26,12 +26,21 @@ public:
 	/// @param[in] layout The layout to position rectangles from.
 	/// @param[in] maximum_dimensions The maximum dimensions of this texture. If this is not big enough to place all the rectangles, then as many will
 	/// be placed as possible.
+	/// @param[in] reserve_free_space True to size the texture for about twice the area of its rectangles, leaving room to place more later.
 	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int maximum_dimensions);
+	int Generate(TextureLayout& layout, int maximum_dimensions, bool reserve_free_space);
+
+	/// Attempts to position a single rectangle in the free space of this texture, without moving any of the already placed rectangles.
+	/// @param[in] layout The layout to position the rectangle from.
+	/// @param[in] rectangle_index The index of the rectangle within the layout.
+	/// @param[in] texture_index The index of this texture within the layout.
+	/// @return True if the rectangle was placed.
+	bool Place(TextureLayout& layout, int rectangle_index, int texture_index);
 
 	/// Allocates the texture.
+	/// @param[in] layout The layout of the rectangles.
 	/// @return The allocated texture data.
-	Vector<byte> AllocateTexture();
+	Vector<byte> AllocateTexture(TextureLayout& layout);
 
 private:
 	using RowList = Vector<TextureLayoutRow>;
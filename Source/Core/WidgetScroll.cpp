@@ -142,6 +142,9 @@ void WidgetScroll::Update()
 				ctx->RequestNextUpdate(arrow_timers[i]);
 		}
 	}
+
+	// Keep receiving updates while the arrows are held down.
+	parent->DirtyUpdate();
 }
 
 void WidgetScroll::SetBarPosition(float _bar_position)
@@ -403,12 +406,14 @@ void WidgetScroll::ProcessEvent(Event& event)
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			ScrollLineUp();
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
+			parent->DirtyUpdate();
 			ScrollLineDown();
 		}
 	}
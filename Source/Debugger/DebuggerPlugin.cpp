@@ -11,6 +11,7 @@
 #include "ElementDebugDocument.h"
 #include "ElementInfo.h"
 #include "ElementLog.h"
+#include "ElementRenderStats.h"
 #include "FontSource.h"
 #include "Geometry.h"
 #include "MenuSource.h"
@@ -33,6 +34,7 @@ DebuggerPlugin::DebuggerPlugin()
 	info_element = nullptr;
 	log_element = nullptr;
 	data_explorer_element = nullptr;
+	render_stats_element = nullptr;
 	hook_element = nullptr;
 
 	render_outlines = false;
@@ -56,7 +58,7 @@ bool DebuggerPlugin::Initialise(Context* context)
 		return false;
 	}
 
-	if (!LoadMenuElement() || !LoadInfoElement() || !LoadLogElement() || !LoadDataExplorerElement())
+	if (!LoadMenuElement() || !LoadInfoElement() || !LoadLogElement() || !LoadDataExplorerElement() || !LoadRenderStatsElement())
 	{
 		Log::Message(Log::LT_ERROR, "Failed to initialise debugger, error while load debugger elements.");
 		return false;
@@ -104,6 +106,11 @@ bool DebuggerPlugin::SetContext(Context* context)
 		data_explorer_element->SetDebugContext(context);
 	}
 
+	if (render_stats_element)
+	{
+		render_stats_element->SetDebugContext(context);
+	}
+
 	debug_context = context;
 	return true;
 }
@@ -198,7 +205,8 @@ void DebuggerPlugin::OnElementDestroy(Element* element)
 {
 	// Detect external destruction of the debugger documents. This can happen for example if the user calls
 	// `Context::UnloadAllDocuments()` on the host context.
-	if (element == menu_element || element == info_element || element == log_element || element == data_explorer_element)
+	if (element == menu_element || element == info_element || element == log_element || element == data_explorer_element ||
+		element == render_stats_element)
 	{
 		ReleaseElements();
 		Log::Message(Log::LT_ERROR,
@@ -219,6 +227,7 @@ void DebuggerPlugin::ProcessEvent(Event& event)
 		{"event-log-button", log_element},
 		{"debug-info-button", info_element},
 		{"data-models-button", data_explorer_element},
+		{"render-stats-button", render_stats_element},
 	};
 
 	if (event == EventId::Click)
@@ -292,7 +301,7 @@ bool DebuggerPlugin::LoadMenuElement()
 
 	menu_element->GetElementById("version-number")->SetInnerRML(Rml::GetVersion());
 
-	for (auto* id : {"event-log-button", "debug-info-button", "outlines-button", "data-models-button"})
+	for (auto* id : {"event-log-button", "debug-info-button", "outlines-button", "data-models-button", "render-stats-button"})
 	{
 		Element* button = menu_element->GetElementById(id);
 		button->AddEventListener(EventId::Click, this);
@@ -375,6 +384,29 @@ bool DebuggerPlugin::LoadDataExplorerElement()
 	return true;
 }
 
+bool DebuggerPlugin::LoadRenderStatsElement()
+{
+	render_stats_element_instancer = MakeUnique<ElementInstancerGeneric<ElementRenderStats>>();
+	Factory::RegisterElementInstancer("debug-render-stats", render_stats_element_instancer.get());
+	render_stats_element = rmlui_dynamic_cast<ElementRenderStats*>(host_context->CreateDocument("debug-render-stats"));
+	if (!render_stats_element)
+		return false;
+
+	render_stats_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+
+	if (!render_stats_element->Initialise(debug_context))
+	{
+		host_context->UnloadDocument(render_stats_element);
+		render_stats_element = nullptr;
+		return false;
+	}
+
+	render_stats_element->AddEventListener(EventId::Hide, this);
+	render_stats_element->AddEventListener(EventId::Show, this);
+
+	return true;
+}
+
 void DebuggerPlugin::SetupInfoListeners(Rml::Context* new_context)
 {
 	RMLUI_ASSERT(info_element);
@@ -427,6 +459,11 @@ void DebuggerPlugin::ReleaseElements()
 			host_context->UnloadDocument(data_explorer_element);
 			data_explorer_element = nullptr;
 		}
+		if (render_stats_element)
+		{
+			host_context->UnloadDocument(render_stats_element);
+			render_stats_element = nullptr;
+		}
 
 		// Update to release documents before the plugin gets deleted.
 		// Helps avoid cleanup crashes.
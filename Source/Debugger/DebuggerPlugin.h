@@ -14,6 +14,7 @@ class ElementLog;
 class ElementInfo;
 class ElementContextHook;
 class ElementDataModels;
+class ElementRenderStats;
 class DebuggerSystemInterface;
 
 /**
@@ -70,6 +71,7 @@ private:
 	bool LoadInfoElement();
 	bool LoadLogElement();
 	bool LoadDataExplorerElement();
+	bool LoadRenderStatsElement();
 
 	void SetupInfoListeners(Rml::Context* new_context);
 
@@ -86,13 +88,14 @@ private:
 	ElementInfo* info_element;
 	ElementLog* log_element;
 	ElementDataModels* data_explorer_element;
+	ElementRenderStats* render_stats_element;
 	ElementContextHook* hook_element;
 
 	Rml::SystemInterface* application_interface;
 	UniquePtr<DebuggerSystemInterface> log_interface;
 
 	UniquePtr<ElementInstancer> hook_element_instancer, debug_document_instancer, info_element_instancer, log_element_instancer,
-		data_explorer_element_instancer;
+		data_explorer_element_instancer, render_stats_element_instancer;
 
 	bool render_outlines;
 
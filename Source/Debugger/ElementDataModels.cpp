@@ -78,7 +78,10 @@ static void ReadDataVariableRecursive(String& out_rml, const int indent_level, c
 
 RMLUI_RTTI_Define(ElementDataModels)
 
-ElementDataModels::ElementDataModels(const String& tag) : ElementDebugDocument(tag) {}
+ElementDataModels::ElementDataModels(const String& tag) : ElementDebugDocument(tag)
+{
+	EnableOnUpdate(true);
+}
 
 ElementDataModels::~ElementDataModels()
 {
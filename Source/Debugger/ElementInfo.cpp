@@ -31,6 +31,7 @@ ElementInfo::ElementInfo(const String& tag) : ElementDebugDocument(tag)
 	force_update_once = false;
 	title_dirty = true;
 	previous_update_time = 0.0;
+	EnableOnUpdate(true);
 }
 
 ElementInfo::~ElementInfo()
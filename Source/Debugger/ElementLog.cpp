@@ -50,6 +50,8 @@ ElementLog::ElementLog(const String& tag) : ElementDebugDocument(tag)
 	log_types[Log::LT_DEBUG].class_name = "debug";
 	log_types[Log::LT_DEBUG].alert_contents = "?";
 	log_types[Log::LT_DEBUG].button_name = "debug_button";
+
+	EnableOnUpdate(true);
 }
 
 ElementLog::~ElementLog()
@@ -0,0 +1,125 @@
+#include "ElementRenderStats.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/RenderStatistics.h"
+#include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "CommonSource.h"
+#include "RenderStatsSource.h"
+
+namespace Rml {
+namespace Debugger {
+
+RMLUI_RTTI_Define(ElementRenderStats)
+
+ElementRenderStats::ElementRenderStats(const String& tag) : ElementDebugDocument(tag)
+{
+	EnableOnUpdate(true);
+}
+
+ElementRenderStats::~ElementRenderStats()
+{
+	RemoveEventListener(EventId::Click, this);
+}
+
+bool ElementRenderStats::Initialise(Context* target_context)
+{
+	SetInnerRML(render_stats_rml);
+	SetId("rmlui-debug-render-stats");
+
+	AddEventListener(EventId::Click, this);
+
+	SharedPtr<StyleSheetContainer> style_sheet = Factory::InstanceStyleSheetString(String(common_rcss) + String(render_stats_rcss));
+	if (!style_sheet)
+		return false;
+
+	SetStyleSheetContainer(std::move(style_sheet));
+
+	SetDebugContext(target_context);
+
+	return true;
+}
+
+void ElementRenderStats::SetDebugContext(Context* new_debug_context)
+{
+	debug_context = new_debug_context;
+}
+
+void ElementRenderStats::OnUpdate()
+{
+	if (!IsVisible() || !debug_context)
+		return;
+
+	const double t = GetSystemInterface()->GetElapsedTime();
+	const float dt = (float)(t - previous_update_time);
+
+	constexpr float update_interval = 0.3f;
+
+	if (dt > update_interval)
+	{
+		previous_update_time = t;
+		UpdateContent();
+	}
+}
+
+void ElementRenderStats::ProcessEvent(Event& event)
+{
+	if (!IsVisible())
+		return;
+
+	Element* target_element = event.GetTargetElement();
+	if (target_element->GetOwnerDocument() != this)
+		return;
+
+	if (event == EventId::Click)
+	{
+		const String& id = event.GetTargetElement()->GetId();
+
+		if (id == "close_button")
+			Hide();
+
+		event.StopPropagation();
+	}
+}
+
+void ElementRenderStats::UpdateContent()
+{
+	RMLUI_ASSERT(debug_context);
+	const RenderStatistics& stats = debug_context->GetRenderStatistics();
+
+	struct Row {
+		const char* name;
+		String value;
+	};
+	const Row rows[] = {
+		{"Elements updated", ToString(stats.elements_updated)},
+		{"Elements rendered", ToString(stats.elements_rendered)},
+		{"Draw calls", ToString(stats.draw_calls)},
+		{"Geometry compiled", ToString(stats.geometry_compiled)},
+		{"Geometry updated", ToString(stats.geometry_updated)},
+		{"Geometry released", ToString(stats.geometry_released)},
+		{"Vertex bytes uploaded", ToString(stats.vertex_bytes_uploaded)},
+		{"Index bytes uploaded", ToString(stats.index_bytes_uploaded)},
+		{"Texture uploads", ToString(stats.texture_uploads)},
+		{"Layers pushed", ToString(stats.layers_pushed)},
+		{"Filters compiled", ToString(stats.filters_compiled)},
+		{"Shaders compiled", ToString(stats.shaders_compiled)},
+		{"Scissor changes", ToString(stats.scissor_changes)},
+		{"Clip mask changes", ToString(stats.clip_mask_changes)},
+		{"Transform changes", ToString(stats.transform_changes)},
+	};
+
+	String new_stats_rml;
+	for (const Row& row : rows)
+		new_stats_rml += "<span class='name'>" + String(row.name) + "</span>: " + row.value + "<br/>";
+
+	if (new_stats_rml != stats_rml)
+	{
+		stats_rml = std::move(new_stats_rml);
+		GetElementById("content")->SetInnerRML(stats_rml);
+	}
+}
+
+} // namespace Debugger
+} // namespace Rml
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
+#include "ElementDebugDocument.h"
+
+namespace Rml {
+namespace Debugger {
+
+class ElementRenderStats : public ElementDebugDocument, public EventListener {
+public:
+	RMLUI_RTTI_DeclareWithParent(ElementRenderStats, ElementDebugDocument)
+
+	ElementRenderStats(const String& tag);
+	~ElementRenderStats();
+
+	bool Initialise(Context* debug_context);
+
+	void SetDebugContext(Context* debug_context);
+
+protected:
+	void ProcessEvent(Event& event) override;
+	void OnUpdate() override;
+
+private:
+	void UpdateContent();
+
+	Context* debug_context = nullptr;
+
+	double previous_update_time = {};
+
+	String stats_rml;
+};
+
+} // namespace Debugger
+} // namespace Rml
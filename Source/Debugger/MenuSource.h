@@ -62,5 +62,6 @@ static const char* menu_rml = R"RML(
 	<button id="debug-info-button">Element Info</button>
 	<button id="outlines-button">Outlines</button>
 	<button id="data-models-button">Data Models</button>
+	<button id="render-stats-button">Render Stats</button>
 </div>
 )RML";
@@ -0,0 +1,24 @@
+static const char* render_stats_rcss = R"RCSS(
+body {
+	width: 280dp;
+	min-width: 280dp;
+	margin-top: 52dp;
+	margin-left: 30dp;
+}
+div#content {
+	height: auto;
+	padding: 5dp 10dp;
+}
+div#content .name {
+	color: #610;
+}
+)RCSS";
+
+static const char* render_stats_rml = R"RML(
+<h1>
+	<handle id="position_handle" move_target="#document"/>
+	<div id="close_button">X</div>
+	<div id="title-content">Render Stats</div>
+</h1>
+<div id="content"></div>
+)RML";
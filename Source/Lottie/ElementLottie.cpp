@@ -16,7 +16,10 @@ namespace Rml {
 
 RMLUI_RTTI_Define(ElementLottie)
 
-ElementLottie::ElementLottie(const String& tag) : Element(tag) {}
+ElementLottie::ElementLottie(const String& tag) : Element(tag)
+{
+	EnableOnUpdate(true);
+}
 
 ElementLottie::~ElementLottie() {}
 
@@ -58,6 +61,7 @@ void ElementLottie::OnUpdate()
 	{
 		if (Context* ctx = GetContext())
 			ctx->RequestNextUpdate(delay);
+		DirtyRender();
 	}
 }
 
@@ -227,6 +227,45 @@ TEST_CASE("element.long_texts")
 	document->Close();
 }
 
+TEST_CASE("element.hit_test")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	nanobench::Bench bench;
+	bench.title("Element hit test");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (const int num_rows : {50, 500, 2000})
+	{
+		el->SetInnerRML(GenerateRml(num_rows, DefaultRow));
+		context->Update();
+		context->Render();
+
+		const Vector2f center = el->GetAbsoluteOffset(BoxArea::Content) + 0.5f * el->GetBox().GetSize(BoxArea::Content);
+		const Vector2i mouse_positions[2] = {Vector2i(center), Vector2i(center) + Vector2i(10, 30)};
+
+		bench.run(CreateString("GetElementAtPoint (%d rows)", num_rows), [&] { context->GetElementAtPoint(center); });
+
+		int i = 0;
+		bench.run(CreateString("ProcessMouseMove + Update (%d rows)", num_rows), [&] {
+			const Vector2i position = mouse_positions[i++ % 2];
+			context->ProcessMouseMove(position.x, position.y, 0);
+			context->Update();
+		});
+	}
+
+	document->Close();
+}
+
 TEST_CASE("element.asymptotic_complexity")
 {
 	Context* context = TestsShell::GetContext();
@@ -217,3 +217,64 @@ TEST_CASE("elementdocument-variables")
 {
 	benchmark(variables_rml);
 }
+
+static const String layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<title>Layout boundaries</title>
+	<style>
+		body { width: 1000px; height: 800px; overflow: auto; }
+		.slot { display: inline-block; width: 60px; height: 40px; margin: 2px; }
+		.slot.boundary { overflow: hidden; }
+		.slot div { display: block; }
+	</style>
+</head>
+<body id="inventory"/>
+</rml>
+)";
+
+TEST_CASE("elementdocument.layout_boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Change a single text node in a large document, with and without layout boundaries to contain the change.
+	for (const String slot_classes : {"slot", "slot boundary"})
+	{
+		ElementDocument* document = context->LoadDocumentFromMemory(layout_boundary_rml);
+		REQUIRE(document);
+		document->Show();
+
+		constexpr int num_slots = 1000;
+		String rml;
+		for (int i = 0; i < num_slots; i++)
+			rml += CreateString(R"(<div class="%s"><div>Item %d</div><div>x%d</div></div>)", slot_classes.c_str(), i, i);
+
+		Element* inventory = document->GetElementById("inventory");
+		inventory->SetInnerRML(rml);
+		TestsShell::RenderLoop();
+
+		Element* count_element = inventory->GetChild(num_slots / 2)->GetChild(1);
+		REQUIRE(count_element);
+
+		nanobench::Bench bench;
+		bench.title(CreateString("ElementDocument layout: %s", slot_classes.c_str()));
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+
+		int count = 0;
+		bench.run("Update (local change)", [&] {
+			count_element->SetInnerRML(CreateString("x%d", count++ % 100));
+			context->Update();
+		});
+
+		bench.run("Update (document change)", [&] {
+			document->SetProperty(PropertyId::Width, Property(float(999 + count++ % 2), Unit::PX));
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
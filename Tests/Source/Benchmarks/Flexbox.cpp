@@ -640,3 +640,58 @@ TEST_CASE("flexbox.shrink-to-fit")
 
 	document->Close();
 }
+
+static const String rml_flexbox_nested_document = R"(
+<rml>
+<head>
+    <title>Flex - Nested</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 800px; }
+		.row { display: flex; flex-direction: row; }
+		.column { display: flex; flex-direction: column; }
+		.item { flex: 1; padding: 2px; }
+	</style>
+</head>
+<body>
+</body>
+</rml>
+)";
+
+static String GenerateNestedFlexRml(int depth)
+{
+	if (depth == 0)
+		return "<div class='item'>Lorem ipsum dolor sit amet</div>";
+
+	const String inner = GenerateNestedFlexRml(depth - 1);
+	return CreateString(R"(<div class="item %s">%s%s</div>)", depth % 2 == 0 ? "row" : "column", inner.c_str(), inner.c_str());
+}
+
+TEST_CASE("flexbox.nested")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Flex items are formatted several times during layout, measure how the cost grows with the nesting depth.
+	nanobench::Bench bench;
+	bench.title("Flexbox nested");
+	bench.relative(true);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_flexbox_nested_document);
+	REQUIRE(document);
+	document->Show();
+
+	for (int depth : {2, 4, 6})
+	{
+		const String rml = GenerateNestedFlexRml(depth);
+		document->SetInnerRML(rml);
+		TestsShell::RenderLoop();
+
+		bench.run(CreateString("SetInnerRML + Update (depth %d)", depth), [&] {
+			document->SetInnerRML(rml);
+			context->Update();
+		});
+	}
+
+	document->Close();
+}
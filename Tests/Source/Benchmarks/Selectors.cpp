@@ -1,3 +1,4 @@
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
@@ -265,3 +266,177 @@ TEST_CASE("Selectors")
 		context->Update();
 	}
 }
+
+TEST_CASE("Selectors.deep_tree")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Benchmark the lookup of applicable style rules in a deeply nested document, with many descendant selectors sharing the same key but whose
+	// ancestor requirements are not met. Without ancestor pruning each such rule requires traversing all the way up to the root.
+	constexpr int num_levels = 30;
+	constexpr int num_panels = 10;
+	constexpr int num_rows = 5;
+	constexpr int num_cells = 5;
+
+	String rml;
+	for (int i = 0; i < num_levels; i++)
+		rml += "<div class=\"level\">";
+	for (int i = 0; i < num_panels; i++)
+	{
+		rml += "<div class=\"panel\">";
+		for (int j = 0; j < num_rows; j++)
+		{
+			rml += "<div class=\"row\">";
+			for (int k = 0; k < num_cells; k++)
+				rml += "<div class=\"cell\"><span>Cell</span></div>";
+			rml += "</div>";
+		}
+		rml += "</div>";
+	}
+	for (int i = 0; i < num_levels; i++)
+		rml += "</div>";
+
+	nanobench::Bench bench;
+	bench.title("Selectors (deep tree)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (int num_rules : {0, 100, 400})
+	{
+		String styles = ".panel .row .cell span { color: #ff0; }\n";
+		for (int i = 0; i < num_rules; i++)
+			styles += Rml::CreateString(".panel%d .row .cell span, .level .row%d span, .missing%d > span { color: #0f%x; }\n", i, i, i, i % 16);
+
+		const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+		document->Show();
+
+		Element* el = document->GetElementById("performance");
+		el->SetInnerRML(rml);
+		context->Update();
+		context->Render();
+
+		bool hover_active = false;
+
+		const String name = Rml::CreateString("%d non-matching descendant rules", num_rules * 3);
+		bench.run(name.c_str(), [&] {
+			hover_active = !hover_active;
+			el->SetPseudoClass("hover", hover_active);
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
+
+TEST_CASE("Selectors.repeated_rows")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Benchmark styling a list of identical rows, where each row can share its style with the row before it.
+	constexpr int num_rows = 1000;
+
+	String rml;
+	for (int i = 0; i < num_rows; i++)
+		rml += "<div class=\"row\"/>";
+
+	String name;
+	String styles = GenerateRCSS(SelectorFlags(CLASS | PSEUDO_CLASS), "", name);
+	styles += GenerateRCSS(TAG, "", name);
+	styles += R"(
+		#performance .row { display: block; height: 20px; border-bottom: 1px #333; }
+		.row:hover { background-color: #666; }
+	)";
+
+	const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+
+	nanobench::Bench bench;
+	bench.title("Selectors (repeated rows)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("Create rows", [&] {
+		el->SetInnerRML(rml);
+		context->Update();
+	});
+
+	bool hover_active = false;
+	bench.run("Restyle rows", [&] {
+		hover_active = !hover_active;
+		el->SetPseudoClass("hover", hover_active);
+		context->Update();
+	});
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("Selectors.parallel_styles")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+
+	// Benchmark restyling several panels of rows when the viewport size changes, with the styles computed on a varying number of workers.
+	constexpr int num_panels = 8;
+	constexpr int num_rows = 100;
+
+	String rml;
+	for (int i = 0; i < num_panels; i++)
+	{
+		rml += "<div class=\"panel\">";
+		for (int j = 0; j < num_rows; j++)
+			rml += "<div class=\"row\"><div class=\"cell\"/><div class=\"cell\"/><div class=\"cell\"/></div>";
+		rml += "</div>";
+	}
+
+	String name;
+	String styles = GenerateRCSS(SelectorFlags(CLASS | PSEUDO_CLASS), "", name);
+	styles += R"(
+		#performance .panel { display: block; width: 10vw; padding: 0.5vh; }
+		#performance .row { display: block; height: 2vh; }
+		#performance .row:nth-child(odd) { margin-left: 1vw; }
+		#performance .cell { display: inline-block; width: 2vw; height: 100%; }
+	)";
+
+	const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	el->SetInnerRML(rml);
+	context->Update();
+
+	nanobench::Bench bench;
+	bench.title("Selectors (parallel styles)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	const Vector2i dimensions = context->GetDimensions();
+	for (int num_workers : {0, 2, 4})
+	{
+		system_interface->SetNumWorkerThreads(num_workers);
+
+		bool resized = false;
+		bench.run(Rml::CreateString("Resize with %d workers", num_workers).c_str(), [&] {
+			resized = !resized;
+			context->SetDimensions(dimensions + Vector2i(resized ? 10 : 0));
+			context->Update();
+		});
+	}
+
+	system_interface->SetNumWorkerThreads(0);
+	context->SetDimensions(dimensions);
+	document->Close();
+	context->Update();
+}
@@ -2,7 +2,9 @@
 #include "TypesToString.h"
 #include <RmlUi/Core/Log.h>
 #include <RmlUi/Core/StringUtilities.h>
+#include <atomic>
 #include <doctest.h>
+#include <thread>
 
 TestsSystemInterface::~TestsSystemInterface()
 {
@@ -40,6 +42,47 @@ bool TestsSystemInterface::LogMessage(Rml::Log::Type type, const Rml::String& me
 	return result;
 }
 
+int TestsSystemInterface::TranslateString(Rml::String& translated, const Rml::String& input)
+{
+	translated = input;
+	int num_translated = 0;
+	for (const auto& translation : translations)
+	{
+		if (translated.find(translation.first) == Rml::String::npos)
+			continue;
+		translated = Rml::StringUtilities::Replace(translated, translation.first, translation.second);
+		num_translated += 1;
+	}
+	return num_translated;
+}
+
+int TestsSystemInterface::GetNumWorkerThreads()
+{
+	return num_worker_threads;
+}
+
+void TestsSystemInterface::RunTasks(int num_tasks, const Rml::Function<void(int)>& task)
+{
+	if (num_worker_threads <= 0)
+	{
+		Rml::SystemInterface::RunTasks(num_tasks, task);
+		return;
+	}
+
+	std::atomic<int> next_task = 0;
+	Rml::Vector<std::thread> threads;
+	for (int i = 0; i < num_worker_threads; i++)
+	{
+		threads.emplace_back([&]() {
+			for (int index = next_task++; index < num_tasks; index = next_task++)
+				task(index);
+		});
+	}
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
 void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 {
 	if (num_expected_warnings > 0)
@@ -67,10 +110,22 @@ void TestsSystemInterface::SetManualTime(double t)
 	elapsed_time = t;
 }
 
+void TestsSystemInterface::SetNumWorkerThreads(int in_num_worker_threads)
+{
+	num_worker_threads = in_num_worker_threads;
+}
+
+void TestsSystemInterface::SetTranslation(const Rml::String& text, const Rml::String& translation)
+{
+	translations.emplace_back(text, translation);
+}
+
 void TestsSystemInterface::Reset()
 {
 	SetManualTime(0);
 	manual_time = false;
+	num_worker_threads = 0;
+	translations.clear();
 
 	SetNumExpectedWarnings(0);
 }
@@ -118,6 +173,13 @@ void TestsRenderInterface::ReleaseGeometry(Rml::CompiledGeometryHandle /*geometr
 	counters.release_geometry += 1;
 }
 
+bool TestsRenderInterface::UpdateGeometry(Rml::CompiledGeometryHandle /*handle*/, Rml::Span<const Rml::Vertex> /*vertices*/,
+	Rml::Span<const int> /*indices*/)
+{
+	counters.update_geometry += 1;
+	return true;
+}
+
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
 {
 	counters.enable_scissor += 1;
@@ -161,6 +223,12 @@ void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
 	counters.release_texture += 1;
 }
 
+bool TestsRenderInterface::UpdateTexture(Rml::TextureHandle /*texture_handle*/, Rml::Span<const Rml::byte> /*source_data*/, Rml::Rectanglei /*region*/)
+{
+	counters.update_texture += 1;
+	return true;
+}
+
 void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
 {
 	counters.set_transform += 1;
@@ -193,6 +261,24 @@ void TestsRenderInterface::ReleaseShader(Rml::CompiledShaderHandle /*shader*/)
 {
 	counters.release_shader += 1;
 }
+
+Rml::LayerHandle TestsRenderInterface::PushLayer()
+{
+	counters.push_layer += 1;
+	return 0;
+}
+
+void TestsRenderInterface::CompositeLayers(Rml::LayerHandle /*source*/, Rml::LayerHandle /*destination*/, Rml::BlendMode /*blend_mode*/,
+	Rml::Span<const Rml::CompiledFilterHandle> /*filters*/)
+{
+	counters.composite_layers += 1;
+}
+
+Rml::TextureHandle TestsRenderInterface::SaveLayerAsTexture()
+{
+	counters.save_layer_as_texture += 1;
+	return 1;
+}
 void TestsRenderInterface::ResetCounters()
 {
 	counters_from_previous_reset = std::exchange(counters, Counters());
@@ -13,18 +13,33 @@ public:
 
 	bool LogMessage(Rml::Log::Type type, const Rml::String& message) override;
 
+	int TranslateString(Rml::String& translated, const Rml::String& input) override;
+
+	int GetNumWorkerThreads() override;
+	void RunTasks(int num_tasks, const Rml::Function<void(int)>& task) override;
+
 	// Checks and clears previously logged messages, then sets the number of expected
 	// warnings and errors until the next call.
 	void SetNumExpectedWarnings(int num_expected_warnings);
 
 	void SetManualTime(double t);
 
+	// Runs tasks on the given number of threads, or on the calling thread when zero.
+	void SetNumWorkerThreads(int num_worker_threads);
+
+	// Translates all occurrences of the given text in subsequent calls to TranslateString.
+	void SetTranslation(const Rml::String& text, const Rml::String& translation);
+
 	void Reset();
 
 private:
 	bool manual_time = false;
 	double elapsed_time = 0.0;
 
+	int num_worker_threads = 0;
+
+	Rml::Vector<Rml::Pair<Rml::String, Rml::String>> translations;
+
 	int num_logged_warnings = 0;
 	int num_expected_warnings = 0;
 
@@ -37,9 +52,11 @@ public:
 		size_t compile_geometry;
 		size_t render_geometry;
 		size_t release_geometry;
+		size_t update_geometry;
 		size_t load_texture;
 		size_t generate_texture;
 		size_t release_texture;
+		size_t update_texture;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t enable_clip_mask;
@@ -50,15 +67,20 @@ public:
 		size_t compile_shader;
 		size_t render_shader;
 		size_t release_shader;
+		size_t push_layer;
+		size_t composite_layers;
+		size_t save_layer_as_texture;
 	};
 
 	Rml::CompiledGeometryHandle CompileGeometry(Rml::Span<const Rml::Vertex> vertices, Rml::Span<const int> indices) override;
 	void RenderGeometry(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, Rml::TextureHandle texture) override;
 	void ReleaseGeometry(Rml::CompiledGeometryHandle handle) override;
+	bool UpdateGeometry(Rml::CompiledGeometryHandle handle, Rml::Span<const Rml::Vertex> vertices, Rml::Span<const int> indices) override;
 
 	Rml::TextureHandle LoadTexture(Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	Rml::TextureHandle GenerateTexture(Rml::Span<const Rml::byte> source_data, Rml::Vector2i source_dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, Rml::Span<const Rml::byte> source_data, Rml::Rectanglei region) override;
 
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(Rml::Rectanglei region) override;
@@ -76,6 +98,11 @@ public:
 		Rml::TextureHandle texture) override;
 	void ReleaseShader(Rml::CompiledShaderHandle shader) override;
 
+	Rml::LayerHandle PushLayer() override;
+	void CompositeLayers(Rml::LayerHandle source, Rml::LayerHandle destination, Rml::BlendMode blend_mode,
+		Rml::Span<const Rml::CompiledFilterHandle> filters) override;
+	Rml::TextureHandle SaveLayerAsTexture() override;
+
 	const Counters& GetCounters() const { return counters; }
 	void ResetCounters();
 	const Counters& GetCountersFromPreviousReset() const { return counters_from_previous_reset; }
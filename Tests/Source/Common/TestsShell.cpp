@@ -182,17 +182,22 @@ Rml::String TestsShell::GetRenderStats()
 								   "  Compile geometry: %zu\n"
 								   "  Render geometry: %zu\n"
 								   "  Release geometry: %zu\n"
+								   "  Update geometry: %zu\n"
 								   "  Texture load: %zu\n"
 								   "  Texture generate: %zu\n"
 								   "  Texture release: %zu\n"
+								   "  Texture update: %zu\n"
 								   "  Scissor enable: %zu\n"
 								   "  Scissor set: %zu\n"
 								   "  Clip mask enable: %zu\n"
 								   "  Clip mask render: %zu\n"
-								   "  Transform set: %zu",
-			counters.compile_geometry, counters.render_geometry, counters.release_geometry, counters.load_texture, counters.generate_texture,
-			counters.release_texture, counters.enable_scissor, counters.set_scissor, counters.enable_clip_mask, counters.render_to_clip_mask,
-			counters.set_transform);
+								   "  Transform set: %zu\n"
+								   "  Layer push: %zu\n"
+								   "  Layer composite: %zu\n"
+								   "  Layer save as texture: %zu",
+			counters.compile_geometry, counters.render_geometry, counters.release_geometry, counters.update_geometry, counters.load_texture,
+			counters.generate_texture, counters.release_texture, counters.update_texture, counters.enable_scissor, counters.set_scissor, counters.enable_clip_mask, counters.render_to_clip_mask,
+			counters.set_transform, counters.push_layer, counters.composite_layers, counters.save_layer_as_texture);
 	}
 
 	return result;
@@ -4,6 +4,10 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/MeshUtilities.h>
+#include <RmlUi/Core/RenderManager.h>
+#include <RmlUi/Core/RenderStream.h>
 #include <Shell.h>
 #include <algorithm>
 #include <doctest.h>
@@ -301,11 +305,17 @@ TEST_CASE("core.release_resources")
 		TestsShell::RenderLoop();
 		CHECK(counters.generate_texture == counter_generate_before);
 
-		// However, when we display a non-ASCII character not part of the initial cache, the font texture needs to be regenerated.
+		// However, when we display a non-ASCII character not part of the initial cache, the glyph is added to the existing font texture.
+		const FontFaceHandle handle = element->GetFontFaceHandle();
+		const int version = GetFontEngineInterface()->GetVersion(handle);
+		const auto counter_update_before = counters.update_texture;
+
 		element->SetInnerRML(reinterpret_cast<const char*>(u8"π"));
 		TestsShell::RenderLoop();
-		CHECK(counters.generate_texture == counter_generate_before + 1);
-		CHECK(counters.release_texture == counter_release_before + 1);
+		CHECK(counters.generate_texture == counter_generate_before);
+		CHECK(counters.release_texture == counter_release_before);
+		CHECK(counters.update_texture == counter_update_before + 1);
+		CHECK(GetFontEngineInterface()->GetVersion(handle) == version);
 	}
 
 	SUBCASE("ReleaseGeometry")
@@ -334,6 +344,712 @@ TEST_CASE("core.release_resources")
 	TestsShell::ResetTestsRenderInterface();
 }
 
+static const String document_batching_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body {
+			display: block;
+			left: 0;
+			top: 0;
+			width: 500px;
+		}
+		div {
+			display: block;
+			height: 20px;
+			margin: 5px;
+			background-color: #c33;
+		}
+	</style>
+</head>
+<body>
+	<div/><div/><div/><div/><div/><div/><div/><div/><div/><div/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.geometry_batching")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	const auto& counters = render_interface->GetCounters();
+	RenderManager& render_manager = context->GetRenderManager();
+
+	// Batching is disabled by default, then each geometry is submitted individually.
+	render_interface->Reset();
+	TestsShell::RenderLoop();
+	CHECK(counters.render_geometry == 10);
+
+	render_manager.EnableGeometryBatching(true);
+	render_interface->Reset();
+	TestsShell::RenderLoop();
+	CHECK(counters.render_geometry == 1);
+	CHECK(counters.compile_geometry == 1);
+
+	// The merged geometry is retained, also when all of it is moved.
+	render_interface->Reset();
+	TestsShell::RenderLoop();
+	document->SetProperty(PropertyId::Left, Property(10.f, Unit::PX));
+	TestsShell::RenderLoop();
+	CHECK(counters.render_geometry == 2);
+	CHECK(counters.compile_geometry == 0);
+
+	// Moving a single element renders it separately, and the geometry before and after it is merged without it.
+	Element* moved = document->GetChild(4);
+	moved->SetProperty(PropertyId::Position, Property(Style::Position::Relative));
+	TestsShell::RenderLoop();
+	TestsShell::RenderLoop();
+	render_interface->Reset();
+	moved->SetProperty(PropertyId::Left, Property(10.f, Unit::PX));
+	TestsShell::RenderLoop();
+	CHECK(counters.render_geometry == 3);
+	CHECK(counters.compile_geometry == 2);
+
+	// While the element keeps moving, the merged geometry around it is retained.
+	render_interface->Reset();
+	for (int i = 2; i <= 5; i++)
+	{
+		moved->SetProperty(PropertyId::Left, Property(10.f * float(i), Unit::PX));
+		TestsShell::RenderLoop();
+	}
+	CHECK(counters.render_geometry == 3 * 4);
+	CHECK(counters.compile_geometry == 0);
+	CHECK(counters.update_geometry == 0);
+
+	// Once it stops, all the geometry is merged again. Merged geometry that is no longer rendered is released after a few frames.
+	render_interface->Reset();
+	TestsShell::RenderLoop();
+	CHECK(counters.render_geometry == 1);
+	CHECK(counters.compile_geometry == 1);
+	for (int i = 0; i < 5; i++)
+		TestsShell::RenderLoop();
+	CHECK(counters.release_geometry == 2);
+
+	render_manager.EnableGeometryBatching(false);
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.render_required")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	document->Show();
+	CHECK(context->IsRenderRequired());
+
+	TestsShell::RenderLoop();
+	context->Update();
+	CHECK(!context->IsRenderRequired());
+
+	// Property changes are visible after the next update.
+	document->GetChild(2)->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 0, 255), Unit::COLOUR));
+	context->Update();
+	CHECK(context->IsRenderRequired());
+	context->Render();
+	CHECK(!context->IsRenderRequired());
+
+	// Changes to the document structure.
+	document->GetChild(0)->SetInnerRML("<div/>");
+	context->Update();
+	CHECK(context->IsRenderRequired());
+	context->Render();
+
+	// Layout changes moving other elements.
+	document->GetChild(0)->SetProperty(PropertyId::Height, Property(50.f, Unit::PX));
+	context->Update();
+	CHECK(context->IsRenderRequired());
+	context->Render();
+
+	// Resizing the context.
+	const Vector2i dimensions = context->GetDimensions();
+	context->SetDimensions(dimensions + Vector2i(10));
+	context->Update();
+	CHECK(context->IsRenderRequired());
+	context->Render();
+	context->SetDimensions(dimensions);
+	TestsShell::RenderLoop();
+
+	// Changes the context cannot observe.
+	context->Update();
+	CHECK(!context->IsRenderRequired());
+	context->RequestNextRender();
+	CHECK(context->IsRenderRequired());
+	context->Render();
+
+	document->Close();
+	context->Update();
+	CHECK(context->IsRenderRequired());
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.damage_region")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	context->Update();
+	CHECK(context->GetDamageRegion().empty());
+
+	// Changing the color of an element only damages its own area.
+	Element* element = document->GetChild(2);
+	element->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 0, 255), Unit::COLOUR));
+	context->Update();
+	REQUIRE(context->GetDamageRegion().size() == 1);
+	const Vector2f offset = element->GetAbsoluteOffset(BoxArea::Border);
+	const Vector2f size = element->GetBox().GetSize(BoxArea::Border);
+	const Rectanglei expected_rectangle = Rectanglei::FromPositionSize(Vector2i(offset), Vector2i(size));
+	CHECK(context->GetDamageRegion()[0] == expected_rectangle);
+	context->Render();
+	CHECK(context->GetDamageRegion().empty());
+
+	// Moving an element damages both its previous and new area, overlapping rectangles are merged.
+	const Rectanglei moved_rectangle = expected_rectangle.Translate(Vector2i(0, 200));
+	element->SetProperty(PropertyId::Position, Property(Style::Position::Relative));
+	element->SetProperty(PropertyId::Top, Property(200.f, Unit::PX));
+	context->Update();
+	REQUIRE(context->GetDamageRegion().size() == 2);
+	CHECK(context->GetDamageRegion()[0] == expected_rectangle);
+	CHECK(context->GetDamageRegion()[1] == moved_rectangle);
+	context->Render();
+
+	element->SetProperty(PropertyId::Top, Property(210.f, Unit::PX));
+	context->Update();
+	REQUIRE(context->GetDamageRegion().size() == 1);
+	CHECK(context->GetDamageRegion()[0] == moved_rectangle.Join(moved_rectangle.Translate(Vector2i(0, 10))));
+	context->Render();
+
+	// Removing an element damages its previous area, in addition to the following siblings moved by the new layout.
+	ElementPtr removed = document->RemoveChild(element);
+	context->Update();
+	const Rectanglei removed_rectangle = moved_rectangle.Translate(Vector2i(0, 10));
+	const auto& region = context->GetDamageRegion();
+	CHECK(std::any_of(region.begin(), region.end(), [&](Rectanglei rectangle) { return rectangle.Join(removed_rectangle) == rectangle; }));
+	context->Render();
+	removed.reset();
+
+	// Transforms are resolved before the damage is computed, thus the transformed area is damaged immediately.
+	Element* transformed = document->GetChild(2);
+	const Rectanglei transformed_rectangle =
+		Rectanglei::FromPositionSize(Vector2i(transformed->GetAbsoluteOffset(BoxArea::Border)), Vector2i(transformed->GetBox().GetSize(BoxArea::Border)));
+	transformed->SetProperty("transform", "translateX(300px)");
+	context->Update();
+	{
+		const Rectanglei translated_rectangle = transformed_rectangle.Translate(Vector2i(300, 0));
+		const auto& transform_region = context->GetDamageRegion();
+		CHECK(std::any_of(transform_region.begin(), transform_region.end(),
+			[&](Rectanglei rectangle) { return rectangle.Join(translated_rectangle) == rectangle; }));
+	}
+	context->Render();
+	transformed->RemoveProperty("transform");
+	TestsShell::RenderLoop();
+
+	// Filters on ancestors spread the damage of their descendants.
+	document->SetProperty("filter", "blur(10px)");
+	TestsShell::RenderLoop();
+	transformed->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 255, 0), Unit::COLOUR));
+	context->Update();
+	REQUIRE(context->GetDamageRegion().size() == 1);
+	CHECK(context->GetDamageRegion()[0] == transformed_rectangle.Extend(30).Intersect(Rectanglei::FromSize(context->GetDimensions())));
+	context->Render();
+	document->RemoveProperty("filter");
+	TestsShell::RenderLoop();
+
+	// Requesting a render damages the whole context.
+	context->RequestNextRender();
+	context->Update();
+	REQUIRE(context->GetDamageRegion().size() == 1);
+	CHECK(context->GetDamageRegion()[0] == Rectanglei::FromSize(context->GetDimensions()));
+	context->Render();
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.render_stream")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	REQUIRE(TestsShell::GetContext());
+
+	RenderStreamRecorder recorder(render_interface);
+	RenderStreamPlayer player(render_interface);
+
+	Context* context = Rml::CreateContext("render_stream", Vector2i(800, 600), &recorder);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	document->Show();
+
+	const auto& counters = render_interface->GetCounters();
+	render_interface->Reset();
+
+	// Nothing is submitted to the render interface until the frame is played.
+	context->Update();
+	context->Render();
+	RenderStreamFrame frame = recorder.TakeFrame();
+	CHECK(!frame.IsEmpty());
+	CHECK(recorder.TakeFrame().IsEmpty());
+	CHECK(counters.compile_geometry == 0);
+	CHECK(counters.render_geometry == 0);
+
+	player.Play(std::move(frame));
+	CHECK(counters.compile_geometry > 0);
+	CHECK(counters.render_geometry == 10);
+
+	// Recording the next frame does not depend on the previous frame being played.
+	render_interface->Reset();
+	context->Update();
+	context->Render();
+	RenderStreamFrame next_frame = recorder.TakeFrame();
+	CHECK(counters.render_geometry == 0);
+	player.Play(std::move(next_frame));
+	CHECK(counters.render_geometry == 10);
+	CHECK(counters.compile_geometry == 0);
+
+	// All resources are released through the recorded stream.
+	Rml::RemoveContext("render_stream");
+	Rml::ReleaseRenderManagers();
+	player.Play(recorder.TakeFrame());
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.render_statistics")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	document->Show();
+
+	const auto& counters = render_interface->GetCounters();
+	render_interface->Reset();
+	TestsShell::RenderLoop();
+
+	// The statistics match the calls made to the render interface during the frame.
+	const RenderStatistics& stats = context->GetRenderStatistics();
+	CHECK(stats.draw_calls == (int)counters.render_geometry);
+	CHECK(stats.geometry_compiled == (int)counters.compile_geometry);
+	CHECK(stats.geometry_compiled > 0);
+	CHECK(stats.vertex_bytes_uploaded > 0);
+	CHECK(stats.index_bytes_uploaded > 0);
+	CHECK(stats.elements_updated >= 11);
+	CHECK(stats.elements_rendered >= 11);
+
+	// Nothing is compiled or updated again when the document is unchanged.
+	render_interface->Reset();
+	TestsShell::RenderLoop();
+	CHECK(stats.draw_calls == (int)counters.render_geometry);
+	CHECK(stats.geometry_compiled == 0);
+	CHECK(stats.vertex_bytes_uploaded == 0);
+	CHECK(stats.elements_updated < stats.elements_rendered);
+
+	// Resizing an element only compiles its own new geometry.
+	document->GetChild(4)->SetProperty(PropertyId::Height, Property(30.f, Unit::PX));
+	TestsShell::RenderLoop();
+	CHECK(stats.geometry_compiled == 1);
+	CHECK(stats.geometry_updated == 0);
+	CHECK(stats.vertex_bytes_uploaded > 0);
+
+	// The totals of the render manager are accumulated over all frames.
+	const RenderStatistics totals = context->GetRenderManager().GetStatistics();
+	CHECK(totals.geometry_compiled >= stats.geometry_compiled);
+	CHECK(totals.draw_calls > stats.draw_calls);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_culling_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body {
+			display: block;
+			left: 0;
+			top: 0;
+			width: 500px;
+		}
+		div {
+			display: block;
+			height: 20px;
+			background-color: #c33;
+		}
+		#layer {
+			position: relative;
+			z-index: 1;
+			height: auto;
+		}
+	</style>
+</head>
+<body>
+	<div id="layer"><div/><div/><div/><div/><div/><div/><div/><div/><div/><div/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.render_culling")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_culling_rml);
+	Element* layer = document->GetElementById("layer");
+	constexpr int num_rows = 100;
+	for (int i = 0; i < num_rows; i++)
+		document->AppendChild(document->CreateElement("div"));
+	document->Show();
+
+	const RenderStatistics& stats = context->GetRenderStatistics();
+	auto render_visible_rows = [&]() {
+		TestsShell::RenderLoop();
+		// Render once more so that the cached bounds of the stacking contexts are also in use.
+		TestsShell::RenderLoop();
+		return stats.elements_rendered;
+	};
+
+	// Only the rows within the 800px window height are rendered.
+	const int num_rendered_initially = render_visible_rows();
+	CHECK(num_rendered_initially < num_rows / 2);
+
+	// Scrolled to the end, the rows at the top are skipped, and the layer is skipped with all its rows as a unit.
+	document->SetProperty(PropertyId::Top, Property(-1500.f, Unit::PX));
+	const int num_rendered_scrolled = render_visible_rows();
+	const int num_rows_in_view = (200 + 20 * num_rows - 1500) / 20;
+	CHECK(num_rendered_scrolled <= num_rows_in_view + 2);
+
+	// Transformed elements are never culled, here the layer is moved back into view.
+	layer->SetProperty("transform", "translateY(1500px)");
+	const int num_rendered_transformed = render_visible_rows();
+	CHECK(num_rendered_transformed == num_rendered_scrolled + 11);
+
+	// Bounds computed under a previous transform are not used for culling, the layer is rendered in the first frame after its transform is
+	// removed.
+	document->SetProperty(PropertyId::Top, Property(0.f, Unit::PX));
+	layer->SetProperty("transform", "translateY(-5000px)");
+	render_visible_rows();
+	layer->RemoveProperty("transform");
+	TestsShell::RenderLoop();
+	CHECK(stats.elements_rendered == num_rendered_initially);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_scroll_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body {
+			display: block;
+			left: 0;
+			top: 0;
+			width: 500px;
+		}
+		#scroll {
+			display: block;
+			margin-top: 50px;
+			height: 200px;
+			overflow: hidden;
+		}
+		#scroll div {
+			display: block;
+			height: 20px;
+			background-color: #c33;
+		}
+		#scroll .relative {
+			position: relative;
+			left: 10px;
+		}
+	</style>
+</head>
+<body>
+	<div id="scroll"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.scroll_offset")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_scroll_rml);
+	Element* scroll = document->GetElementById("scroll");
+	constexpr int num_rows = 1000;
+	for (int i = 0; i < num_rows; i++)
+	{
+		ElementPtr row = document->CreateElement("div");
+		if (i % 100 == 0)
+			row->SetClass("relative", true);
+		scroll->AppendChild(std::move(row));
+	}
+	document->Show();
+	TestsShell::RenderLoop();
+
+	const Rectanglei scroll_rectangle =
+		Rectanglei::FromPositionSize(Vector2i(scroll->GetAbsoluteOffset(BoxArea::Border)), Vector2i(scroll->GetBox().GetSize(BoxArea::Border)));
+	const RenderStatistics& stats = context->GetRenderStatistics();
+
+	for (const float scroll_top : {1000.f, 1020.f, 5000.f, 0.f})
+	{
+		scroll->SetScrollTop(scroll_top);
+
+		// Only the area of the scroll container is damaged, its rows are not dirtied one by one.
+		context->Update();
+		const auto& region = context->GetDamageRegion();
+		CHECK(!region.empty());
+		CHECK(std::all_of(region.begin(), region.end(), [&](Rectanglei rectangle) { return scroll_rectangle.Join(rectangle) == scroll_rectangle; }));
+		context->Render();
+
+		// The rows are still placed at their scrolled position.
+		for (int i : {0, 50, 51, 100, 250, 999})
+		{
+			Element* row = scroll->GetChild(i);
+			const float expected_left = (i % 100 == 0 ? 10.f : 0.f);
+			const float expected_top = 50.f + 20.f * float(i) - scroll_top;
+			CHECK(row->GetAbsoluteLeft() == expected_left);
+			CHECK(row->GetAbsoluteTop() == expected_top);
+
+			if (expected_top >= 50.f && expected_top < 250.f)
+				CHECK(context->GetElementAtPoint(Vector2f(expected_left + 1.f, expected_top + 1.f)) == row);
+		}
+
+		// Rows outside the scroll container are culled using their moved area.
+		TestsShell::RenderLoop();
+		CHECK(stats.elements_rendered < 50);
+	}
+
+	// Rows that are not clipped by the scroll container render outside of it, thus they need to be damaged when moved.
+	Element* unclipped_row = scroll->GetChild(5);
+	unclipped_row->SetProperty("clip", "none");
+	TestsShell::RenderLoop();
+
+	scroll->SetScrollTop(120.f);
+	context->Update();
+	const auto& region = context->GetDamageRegion();
+	CHECK(unclipped_row->GetAbsoluteTop() == 30.f);
+	CHECK(std::any_of(region.begin(), region.end(), [&](Rectanglei rectangle) { return rectangle.Contains(Vector2i(1, 35)); }));
+	context->Render();
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_filter_cache_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body {
+			display: block;
+			left: 0;
+			top: 0;
+			width: 500px;
+		}
+		div {
+			display: block;
+			height: 20px;
+			background-color: #c33;
+		}
+		#filtered {
+			height: auto;
+			filter: opacity(0.5);
+		}
+	</style>
+</head>
+<body>
+	<div id="filtered"><div/><div id="child"/><div/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.filter_cache")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_filter_cache_rml);
+	Element* child = document->GetElementById("child");
+	document->Show();
+
+	const auto& counters = render_interface->GetCounters();
+	const RenderStatistics& stats = context->GetRenderStatistics();
+	auto render_frame = [&]() {
+		render_interface->ResetCounters();
+		TestsShell::RenderLoop();
+	};
+
+	// The content is rendered normally on the first frame, and saved to the cache on the next frame it is unchanged.
+	render_frame();
+	CHECK(counters.push_layer == 1);
+	CHECK(counters.save_layer_as_texture == 0);
+	const int num_elements_rendered = stats.elements_rendered;
+
+	render_frame();
+	CHECK(counters.push_layer == 2);
+	CHECK(counters.save_layer_as_texture == 1);
+
+	// Then the saved result is rendered without visiting the filtered content.
+	for (int i = 0; i < 2; i++)
+	{
+		render_frame();
+		CHECK(counters.push_layer == 0);
+		CHECK(counters.composite_layers == 0);
+		CHECK(counters.save_layer_as_texture == 0);
+		CHECK(stats.layers_pushed == 0);
+		CHECK(stats.elements_rendered == num_elements_rendered - 3);
+	}
+
+	// Changing any element within the filtered content invalidates the cache.
+	child->SetProperty(PropertyId::BackgroundColor, Property(Colourb(0, 0, 255), Unit::COLOUR));
+	render_frame();
+	CHECK(counters.push_layer == 1);
+	CHECK(counters.save_layer_as_texture == 0);
+	CHECK(stats.elements_rendered == num_elements_rendered);
+
+	render_frame();
+	CHECK(counters.save_layer_as_texture == 1);
+
+	render_frame();
+	CHECK(counters.push_layer == 0);
+
+	// Releasing the textures invalidates the cache, the filtered content is rendered again instead of an untextured quad.
+	Rml::ReleaseTextures();
+	render_frame();
+	CHECK(counters.push_layer == 2);
+	CHECK(counters.save_layer_as_texture == 1);
+	CHECK(stats.elements_rendered == num_elements_rendered);
+
+	render_frame();
+	CHECK(counters.push_layer == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_text_glyphs_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 15px; color: #f00; }
+		p { font-effect: outline(2px #00f8); }
+	</style>
+</head>
+<body>
+	<p id="text">Hello glyphs</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.text_glyphs")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_text_glyphs_rml);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* paragraph = document->GetElementById("text");
+	Element* text_element = paragraph->GetFirstChild();
+	const FontFaceHandle face_handle = text_element->GetFontFaceHandle();
+	REQUIRE(face_handle);
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const FontEffectsPtr font_effects = paragraph->GetProperty(PropertyId::FontEffect)->Get<FontEffectsPtr>();
+	REQUIRE(bool(font_effects));
+	const FontEffectsHandle font_effects_handle = font_engine_interface->PrepareFontEffects(face_handle, font_effects->list);
+
+	RenderManager& render_manager = context->GetRenderManager();
+	const String language;
+	const TextShapingContext text_shaping_context{language};
+	const String string = "Hello glyphs";
+	const Vector2f position = {10.f, 20.f};
+
+	TexturedGlyphsList glyphs_list;
+	const int width = font_engine_interface->GenerateStringGlyphs(render_manager, face_handle, font_effects_handle, string, position,
+		text_shaping_context, glyphs_list);
+	CHECK(width > 0);
+	// One list for the outline effect, and one for the text itself.
+	REQUIRE(glyphs_list.size() == 2);
+	CHECK(!glyphs_list[0].text_colour);
+	CHECK(glyphs_list[1].text_colour);
+
+	// Meshes generated from glyphs match the meshes generated directly, also when their colours are applied to the meshes afterwards.
+	for (const float opacity : {1.f, 0.5f})
+	{
+		const ColourbPremultiplied colour = Colourb(255, 0, 0).ToPremultiplied(opacity);
+
+		TexturedMeshList mesh_list;
+		CHECK(font_engine_interface->GenerateString(render_manager, face_handle, font_effects_handle, string, position, colour, opacity,
+				  text_shaping_context, mesh_list) == width);
+		REQUIRE(mesh_list.size() == glyphs_list.size());
+
+		for (size_t i = 0; i < glyphs_list.size(); i++)
+		{
+			CHECK(!glyphs_list[i].glyphs.empty());
+			CHECK(glyphs_list[i].texture == mesh_list[i].texture);
+
+			Mesh mesh;
+			MeshUtilities::GenerateGlyphs(mesh, glyphs_list[i], colour, opacity);
+			CHECK(mesh == mesh_list[i].mesh);
+
+			Mesh recoloured_mesh;
+			MeshUtilities::GenerateGlyphs(recoloured_mesh, glyphs_list[i], ColourbPremultiplied(0, 255, 0, 255), 1.f);
+			MeshUtilities::SetGlyphColours(recoloured_mesh, glyphs_list[i], colour, opacity);
+			CHECK(recoloured_mesh == mesh_list[i].mesh);
+		}
+	}
+
+	// Fading the text recolours its existing geometry, which is updated in place rather than compiled again.
+	const RenderStatistics& stats = context->GetRenderStatistics();
+	for (const float opacity : {0.75f, 0.5f, 0.25f})
+	{
+		paragraph->SetProperty(PropertyId::Opacity, Property(opacity, Unit::NUMBER));
+		TestsShell::RenderLoop();
+		CHECK(stats.geometry_compiled == 0);
+		CHECK(stats.geometry_updated > 0);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
 TEST_CASE("core.initialize")
 {
 	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
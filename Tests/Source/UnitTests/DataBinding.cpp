@@ -1,8 +1,10 @@
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementText.h>
 #include <cmath>
 #include <doctest.h>
 
@@ -988,3 +990,457 @@ TEST_CASE("data_binding.data-value")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("data_binding.dirty_address")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static const String document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+</head>
+<body template="window" data-model="rows">
+<p id="first">{{ rows[0].name }}</p>
+<p id="count">{{ rows.size }}</p>
+<div class="row" data-for="row : rows">{{ row.name }}: {{ row.value }}</div>
+</body>
+</rml>
+)";
+
+	struct Row {
+		String name;
+		int value;
+	};
+	Vector<Row> rows = {{"a", 1}, {"b", 2}, {"c", 3}};
+
+	DataModelConstructor constructor = context->CreateDataModel("rows");
+	REQUIRE(constructor);
+
+	if (auto row_handle = constructor.RegisterStruct<Row>())
+	{
+		row_handle.RegisterMember("name", &Row::name);
+		row_handle.RegisterMember("value", &Row::value);
+	}
+	REQUIRE(constructor.RegisterArray<Vector<Row>>());
+	REQUIRE(constructor.Bind("rows", &rows));
+
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	auto GetRowsText = [&]() {
+		ElementList row_elements;
+		document->GetElementsByClassName(row_elements, "row");
+		StringList result;
+		for (Element* element : row_elements)
+		{
+			if (element->HasAttribute("data-for"))
+				continue;
+			result.push_back(element->GetInnerRML());
+		}
+		return result;
+	};
+	Element* first = document->GetElementById("first");
+
+	CHECK(GetRowsText() == StringList{"a: 1", "b: 2", "c: 3"});
+	CHECK(first->GetInnerRML() == "a");
+
+	// Only views bound to the dirtied array entry are updated.
+	rows[0].value = 10;
+	rows[1].value = 20;
+	handle.DirtyVariable("rows", 1);
+	TestsShell::RenderLoop();
+	CHECK(GetRowsText() == StringList{"a: 1", "b: 20", "c: 3"});
+
+	// Views bound to the dirtied member, or its parent entry, are updated, but not views bound to its siblings.
+	rows[0].name = "x";
+	handle.DirtyAddress(DataAddress{DataAddressEntry("rows"), DataAddressEntry(0), DataAddressEntry("value")});
+	TestsShell::RenderLoop();
+	CHECK(GetRowsText() == StringList{"x: 10", "b: 20", "c: 3"});
+	CHECK(first->GetInnerRML() == "a");
+
+	// Dirtying the whole variable updates all of its views.
+	rows.push_back({"d", 4});
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+	CHECK(GetRowsText() == StringList{"x: 10", "b: 20", "c: 3", "d: 4"});
+	CHECK(first->GetInnerRML() == "x");
+
+	// Views of removed rows no longer respond to their addresses.
+	rows.resize(2);
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+	CHECK(GetRowsText() == StringList{"x: 10", "b: 20"});
+
+	rows[1].value = 200;
+	handle.DirtyVariable("rows", 1);
+	handle.DirtyVariable("rows", 3);
+	TestsShell::RenderLoop();
+	CHECK(GetRowsText() == StringList{"x: 10", "b: 200"});
+
+	// Dirtying an entry also dirties the size of the array, as the entry may have been added.
+	Element* count = document->GetElementById("count");
+	CHECK(count->GetInnerRML() == "2");
+	rows.push_back({"e", 5});
+	handle.DirtyVariable("rows", 2);
+	TestsShell::RenderLoop();
+	CHECK(GetRowsText() == StringList{"x: 10", "b: 200", "e: 5"});
+	CHECK(count->GetInnerRML() == "3");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("data_binding.data_for_keyed")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static const String document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+</head>
+<body template="window" data-model="rows">
+<div id="list">
+<p data-for="row, i : rows" data-key="row.id" data-attr-index="i" data-event-click="row.name = 'clicked'">{{ row.name }}</p>
+</div>
+</body>
+</rml>
+)";
+
+	struct Row {
+		int id;
+		String name;
+	};
+	Vector<Row> rows = {{1, "a"}, {2, "b"}, {3, "c"}};
+
+	DataModelConstructor constructor = context->CreateDataModel("rows");
+	REQUIRE(constructor);
+
+	if (auto row_handle = constructor.RegisterStruct<Row>())
+	{
+		row_handle.RegisterMember("id", &Row::id);
+		row_handle.RegisterMember("name", &Row::name);
+	}
+	REQUIRE(constructor.RegisterArray<Vector<Row>>());
+	REQUIRE(constructor.Bind("rows", &rows));
+
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	Element* list = document->GetElementById("list");
+
+	// Returns the generated row elements in document order, skipping the data-for element itself.
+	auto GetRowElements = [&]() {
+		ElementList result;
+		for (int i = 0; i < list->GetNumChildren(); i++)
+		{
+			Element* child = list->GetChild(i);
+			if (!child->HasAttribute("data-for"))
+				result.push_back(child);
+		}
+		return result;
+	};
+	auto CheckRows = [&](const ElementList& row_elements) {
+		REQUIRE(row_elements.size() == rows.size());
+		for (size_t i = 0; i < rows.size(); i++)
+		{
+			CHECK(row_elements[i]->GetInnerRML() == rows[i].name);
+			CHECK(row_elements[i]->GetAttribute<int>("index", -1) == (int)i);
+			CHECK(!row_elements[i]->HasAttribute("data-key"));
+		}
+	};
+
+	const ElementList initial_elements = GetRowElements();
+	CheckRows(initial_elements);
+
+	// Reordering the entries moves their elements.
+	std::reverse(rows.begin(), rows.end());
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+
+	ElementList row_elements = GetRowElements();
+	CheckRows(row_elements);
+	CHECK(row_elements == ElementList{initial_elements[2], initial_elements[1], initial_elements[0]});
+
+	// Moved elements are bound to their new entries.
+	row_elements[0]->DispatchEvent(EventId::Click, Dictionary());
+	TestsShell::RenderLoop();
+	CHECK(rows[0].id == 3);
+	CHECK(rows[0].name == "clicked");
+	CHECK(rows[2].name == "a");
+	CheckRows(GetRowElements());
+
+	// Inserting and removing entries only creates and removes their own elements.
+	rows.insert(rows.begin(), Row{4, "d"});
+	rows.erase(rows.begin() + 2);
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+
+	row_elements = GetRowElements();
+	CheckRows(row_elements);
+	REQUIRE(row_elements.size() == 3);
+	CHECK(row_elements[1] == initial_elements[2]);
+	CHECK(row_elements[2] == initial_elements[0]);
+
+	// Dirtying a single entry by address reaches the moved element.
+	rows[2].name = "e";
+	handle.DirtyVariable("rows", 2);
+	TestsShell::RenderLoop();
+	CheckRows(GetRowElements());
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("data_binding.data_for_template")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static const String document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+</head>
+<body template="window" data-model="rows">
+<div class="row" data-for="row : rows"><span data-attr-title="row.name">{{ row.name }}</span><i data-for="tag : row.tags">{{ tag }}</i>&lt;end&gt;</div>
+</body>
+</rml>
+)";
+
+	struct Row {
+		String name;
+		StringList tags;
+	};
+	Vector<Row> rows = {{"a", {"x"}}, {"b", {"y", "z"}}};
+
+	DataModelConstructor constructor = context->CreateDataModel("rows");
+	REQUIRE(constructor);
+
+	REQUIRE(constructor.RegisterArray<StringList>());
+	if (auto row_handle = constructor.RegisterStruct<Row>())
+	{
+		row_handle.RegisterMember("name", &Row::name);
+		row_handle.RegisterMember("tags", &Row::tags);
+	}
+	REQUIRE(constructor.RegisterArray<Vector<Row>>());
+	REQUIRE(constructor.Bind("rows", &rows));
+
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto CheckRows = [&]() {
+		ElementList row_elements;
+		document->GetElementsByClassName(row_elements, "row");
+		row_elements.erase(std::remove_if(row_elements.begin(), row_elements.end(), [](Element* element) { return element->HasAttribute("data-for"); }),
+			row_elements.end());
+
+		REQUIRE(row_elements.size() == rows.size());
+		for (size_t i = 0; i < rows.size(); i++)
+		{
+			// Each element is instanced from the same pre-parsed contents, with its own bindings.
+			ElementList spans;
+			row_elements[i]->GetElementsByTagName(spans, "span");
+			REQUIRE(spans.size() == 1);
+			CHECK(spans[0]->GetAttribute<String>("title", "") == rows[i].name);
+			CHECK(spans[0]->GetInnerRML() == rows[i].name);
+
+			ElementList tags;
+			row_elements[i]->GetElementsByTagName(tags, "i");
+			tags.erase(std::remove_if(tags.begin(), tags.end(), [](Element* element) { return element->HasAttribute("data-for"); }), tags.end());
+			REQUIRE(tags.size() == rows[i].tags.size());
+			for (size_t j = 0; j < tags.size(); j++)
+				CHECK(tags[j]->GetInnerRML() == rows[i].tags[j]);
+
+			Element* last_child = row_elements[i]->GetChild(row_elements[i]->GetNumChildren() - 1);
+			ElementText* end_text = rmlui_dynamic_cast<ElementText*>(last_child);
+			REQUIRE(end_text);
+			CHECK(end_text->GetText() == "<end>");
+		}
+	};
+
+	TestsShell::RenderLoop();
+	CheckRows();
+
+	rows.push_back({"c", {"w"}});
+	rows[0].tags.push_back("v");
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+	CheckRows();
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("data_binding.data_for_template_translation")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+
+	static const String document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+</head>
+<body template="window" data-model="rows">
+<div class="row" data-for="row : rows"><b>hello</b></div>
+</body>
+</rml>
+)";
+
+	StringList rows = {"a"};
+
+	DataModelConstructor constructor = context->CreateDataModel("rows");
+	REQUIRE(constructor);
+	REQUIRE(constructor.RegisterArray<StringList>());
+	REQUIRE(constructor.Bind("rows", &rows));
+
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	auto GetRowsText = [&]() {
+		ElementList bold_elements;
+		document->GetElementsByTagName(bold_elements, "b");
+		StringList result;
+		for (Element* element : bold_elements)
+		{
+			if (!element->GetParentNode()->HasAttribute("data-for"))
+				result.push_back(element->GetInnerRML());
+		}
+		return result;
+	};
+	CHECK(GetRowsText() == StringList{"hello"});
+
+	// Rows created after the translation changes use the new translation of the contents.
+	system_interface->SetTranslation("<b>hello</b>", "<b>hei</b>");
+	rows.push_back("b");
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+	CHECK(GetRowsText() == StringList{"hello", "hei"});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("data_binding.data_for_virtual")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static const String document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		#list { height: 200px; overflow-y: scroll; }
+		#list p { height: 20px; margin: 0; padding: 0; }
+	</style>
+</head>
+<body template="window" data-model="rows">
+<div id="list">
+<p data-for="row, i : rows" data-virtual-row-height="20" data-virtual-overscan="2" data-attr-index="i">{{ row }}</p>
+</div>
+</body>
+</rml>
+)";
+
+	constexpr int num_rows = 5000;
+	constexpr int row_height = 20;
+	constexpr int max_elements = 200 / row_height + 2 * 2 + 1;
+
+	StringList rows;
+	for (int i = 0; i < num_rows; i++)
+		rows.push_back(CreateString("row%d", i));
+
+	DataModelConstructor constructor = context->CreateDataModel("rows");
+	REQUIRE(constructor);
+	REQUIRE(constructor.RegisterArray<StringList>());
+	REQUIRE(constructor.Bind("rows", &rows));
+
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+
+	// Checks that the generated rows form a contiguous range of entries, placed between the two spacers.
+	auto CheckRows = [&](int expected_first_index) {
+		REQUIRE(list->GetNumChildren() >= 3);
+		Element* spacer_top = list->GetChild(0);
+		Element* spacer_bottom = list->GetChild(list->GetNumChildren() - 2);
+		CHECK(list->GetChild(list->GetNumChildren() - 1)->HasAttribute("data-for"));
+
+		const int num_elements = list->GetNumChildren() - 3;
+		CHECK(num_elements > 0);
+		CHECK(num_elements <= max_elements);
+
+		const int first_index = list->GetChild(1)->GetAttribute<int>("index", -1);
+		CHECK(first_index == expected_first_index);
+		for (int i = 0; i < num_elements; i++)
+		{
+			Element* row_element = list->GetChild(1 + i);
+			CHECK(row_element->GetAttribute<int>("index", -1) == first_index + i);
+			CHECK(row_element->GetInnerRML() == rows[first_index + i]);
+			CHECK(!row_element->HasAttribute("data-virtual-row-height"));
+		}
+
+		CHECK(spacer_top->GetBox().GetSize().y == float(first_index * row_height));
+		CHECK(spacer_bottom->GetBox().GetSize().y == float((num_rows - first_index - num_elements) * row_height));
+		CHECK(list->GetScrollHeight() == float(num_rows * row_height));
+	};
+
+	TestsShell::RenderLoop();
+	TestsShell::RenderLoop();
+	CheckRows(0);
+
+	// Scrolling recycles the elements for the entries that come into view.
+	list->SetScrollTop(float(1000 * row_height));
+	TestsShell::RenderLoop();
+	TestsShell::RenderLoop();
+	CheckRows(1000 - 2);
+
+	// Changes to the entries reach the recycled elements.
+	rows[1000] = "changed";
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+	CheckRows(1000 - 2);
+
+	// Shrinking the array shifts the range to the remaining entries.
+	rows.resize(1005);
+	handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+	TestsShell::RenderLoop();
+	CHECK(list->GetNumChildren() - 3 <= max_elements);
+	CHECK(list->GetChild(list->GetNumChildren() - 3)->GetAttribute<int>("index", -1) == 1004);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
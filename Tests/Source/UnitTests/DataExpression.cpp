@@ -26,6 +26,15 @@ static String TestExpression(const String& expression)
 			result = interpreter.Result().Get<String>();
 		else
 			FAIL_CHECK("Could not execute expression: " << expression << "\n\n  Parsed program: \n" << DumpProgram(program));
+
+		// The compiled program must give the same result as the parsed one.
+		Program compiled_program = CompileProgram(program, addresses);
+		DataInterpreter compiled_interpreter(compiled_program, addresses, interface);
+
+		if (compiled_interpreter.Run())
+			CHECK_MESSAGE(compiled_interpreter.Result().Get<String>() == result, "Compiled program: \n" << DumpProgram(compiled_program));
+		else
+			FAIL_CHECK("Could not execute compiled expression: " << expression << "\n\n  Compiled program: \n" << DumpProgram(compiled_program));
 	}
 	else
 	{
@@ -173,3 +182,54 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("true ? num_multi[0] : num_multi[999]") == "left");
 	CHECK(TestExpression("false ? num_multi[999] : num_multi[1]") == "right");
 }
+
+static String CompileExpression(const String& expression)
+{
+	DataParser parser(expression, interface);
+	if (!parser.Parse(false))
+	{
+		FAIL_CHECK("Could not parse expression: " << expression);
+		return String();
+	}
+
+	AddressList addresses = parser.ReleaseAddresses();
+	const Program program = CompileProgram(parser.ReleaseProgram(), addresses);
+
+	String result;
+	for (const InstructionData& data : program)
+		result += char(data.instruction);
+	return result;
+}
+
+TEST_CASE("Data expressions compile")
+{
+	String name = "a";
+	int number = 1;
+
+	DataModelConstructor constructor(&model);
+	constructor.Bind("compile_name", &name);
+	constructor.Bind("compile_number", &number);
+
+	// Operators on literals are folded.
+	CHECK(CompileExpression("5*(1+2)") == "D");
+	CHECK(CompileExpression("!true") == "D");
+	CHECK(CompileExpression("'a' + 'b' == 'ab' ? 1 : 2") == "DZDJD");
+
+	// Operators on operands of known types are specialized.
+	CHECK(CompileExpression("compile_name == 'a'") == "VPDos");
+	CHECK(CompileExpression("compile_name != 'a'") == "VPDot");
+	CHECK(CompileExpression("'x' + compile_name") == "DPVoc");
+	CHECK(CompileExpression("(compile_number - 1) + 2") == "VPDo-PDoa");
+	CHECK(CompileExpression("(compile_number < 1) == true") == "VPDo<PDoq");
+
+	// Operands of unknown type keep the generic operators.
+	CHECK(CompileExpression("compile_name + compile_number") == "VPVo+");
+	CHECK(CompileExpression("compile_number == 1") == "VPDo=");
+
+	// The types of both branches of a ternary must agree.
+	CHECK(CompileExpression("(compile_number ? 'a' : 'b') + compile_name") == "VZDJDPVoc");
+	CHECK(CompileExpression("(compile_number ? 'a' : 2) + compile_name") == "VZDJDPVo+");
+
+	CHECK(TestExpression("compile_name == 'a' ? compile_name + '!' : 'no'") == "a!");
+	CHECK(TestExpression("(compile_number - 1) + 2 == 2") == "1");
+}
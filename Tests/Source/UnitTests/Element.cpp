@@ -2,9 +2,11 @@
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include "../Common/TypesToString.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
 #include <RmlUi/Core/ElementScroll.h>
 #include <RmlUi/Core/Factory.h>
 #include <doctest.h>
@@ -485,3 +487,197 @@ TEST_CASE("Element.ScrollbarDestruction")
 
 	TestsShell::ShutdownShell();
 }
+
+namespace {
+class ElementUpdateCounter : public Element {
+public:
+	ElementUpdateCounter(const String& tag) : Element(tag) {}
+
+	void SetUpdateEveryFrame(bool enable) { EnableOnUpdate(enable); }
+
+	int num_updates = 0;
+
+protected:
+	void OnUpdate() override { num_updates += 1; }
+};
+} // namespace
+
+TEST_CASE("Element.UpdateCleanSubtrees")
+{
+	const String document_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		.wide { width: 200px; }
+	</style>
+</head>
+<body>
+	<counter id="a"/>
+	<div><div><counter id="b"/></div></div>
+</body>
+</rml>
+)";
+
+	ElementInstancerGeneric<ElementUpdateCounter> instancer;
+	Context* context = TestsShell::GetContext();
+	Factory::RegisterElementInstancer("counter", &instancer);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	document->Show();
+	context->Update();
+
+	auto a = dynamic_cast<ElementUpdateCounter*>(document->GetElementById("a"));
+	auto b = dynamic_cast<ElementUpdateCounter*>(document->GetElementById("b"));
+	REQUIRE(a);
+	REQUIRE(b);
+
+	a->num_updates = 0;
+	b->num_updates = 0;
+
+	// Nothing has changed, so the elements should not be visited.
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	CHECK(a->num_updates == 0);
+	CHECK(b->num_updates == 0);
+
+	// Changes deep in the tree are still picked up after idle updates.
+	b->SetClass("wide", true);
+	context->Update();
+	CHECK(a->num_updates == 0);
+	CHECK(b->num_updates >= 1);
+	CHECK(b->GetComputedValues().width().value == 200.f);
+
+	b->SetProperty(PropertyId::Width, Property(100.f, Unit::PX));
+	context->Update();
+	CHECK(a->num_updates == 0);
+	CHECK(b->GetComputedValues().width().value == 100.f);
+
+	// Elements with OnUpdate enabled are visited on every update.
+	a->SetUpdateEveryFrame(true);
+	a->num_updates = 0;
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	CHECK(a->num_updates == 3);
+
+	a->SetUpdateEveryFrame(false);
+	context->Update();
+	context->Update();
+	a->num_updates = 0;
+	b->num_updates = 0;
+	for (int i = 0; i < 3; i++)
+		context->Update();
+	CHECK(a->num_updates == 0);
+	CHECK(b->num_updates == 0);
+
+	// Single updates can be requested explicitly.
+	b->DirtyUpdate();
+	context->Update();
+	context->Update();
+	CHECK(a->num_updates == 0);
+	CHECK(b->num_updates == 1);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Element.HitTest")
+{
+	const String document_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { width: 600px; height: 500px; font-family: LatoLatin; font-size: 15px; }
+		#scroll { width: 300px; height: 200px; overflow: auto; }
+		#scroll div { height: 23px; border: 1px #000; }
+		#scroll span { margin-left: 20px; }
+		.box { display: inline-block; width: 70px; height: 50px; margin: 5px; }
+		.abs { position: absolute; left: 250px; top: 150px; width: 150px; height: 150px; }
+		.z { position: relative; z-index: 1; top: -40px; }
+		.noevents { pointer-events: none; }
+		#dummy { position: absolute; left: 0; top: 0; width: 0; height: 0; pointer-events: none; }
+	</style>
+</head>
+<body>
+	<div id="scroll"/>
+	<div class="box" id="mover"/><div class="box z"><div class="box">Nested</div></div><div class="box noevents"/>
+	<div class="abs">Absolute text that wraps <span>several</span> lines of inline content.</div>
+	<div id="dummy"/>
+</body>
+</rml>
+)";
+
+	Context* context = TestsShell::GetContext();
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	document->Show();
+
+	String rows_rml;
+	for (int i = 0; i < 50; i++)
+		rows_rml += CreateString("<div>Row %d <span>child</span></div>", i);
+	Element* scroll = document->GetElementById("scroll");
+	scroll->SetInnerRML(rows_rml);
+	Element* dummy = document->GetElementById("dummy");
+
+	context->Update();
+
+	// Changing the z-index of the dummy element rebuilds the document's stacking context, which invalidates its hit test grid. Then the
+	// first lookup tests every element in the stacking context.
+	int dummy_z_index = 0;
+	auto get_element_full_search = [&](Vector2f point) {
+		dummy_z_index = (dummy_z_index + 1) % 2;
+		dummy->SetProperty(PropertyId::ZIndex, Property(float(dummy_z_index), Unit::NUMBER));
+		context->Update();
+		return context->GetElementAtPoint(point);
+	};
+
+	auto check_points = [&](const Vector<Element*>& elements) {
+		int i = 0;
+		for (int y = 0; y < 520; y += 13)
+		{
+			for (int x = 0; x < 620; x += 17)
+			{
+				const Vector2f point = {float(x), float(y)};
+				Element* expected_element = get_element_full_search(point);
+				Element* element = elements[i++];
+				CHECK_MESSAGE(element == expected_element, "Point ", point, ", expected ",
+					(expected_element ? expected_element->GetAddress() : "null"), ", got ", (element ? element->GetAddress() : "null"));
+			}
+		}
+	};
+
+	auto get_elements = [&]() {
+		Vector<Element*> elements;
+		for (int y = 0; y < 520; y += 13)
+			for (int x = 0; x < 620; x += 17)
+				elements.push_back(context->GetElementAtPoint({float(x), float(y)}));
+		return elements;
+	};
+
+	for (const float scroll_top : {0.f, 333.f})
+	{
+		scroll->SetScrollTop(scroll_top);
+		context->Update();
+
+		// Consecutive lookups without any changes use the hit test grid.
+		get_elements();
+		check_points(get_elements());
+	}
+
+	// Moving and resizing elements updates their entries in the hit test grid, including the siblings moved along with them.
+	Element* mover = document->GetElementById("mover");
+	for (const float margin_left : {45.f, 260.f, 0.f})
+	{
+		get_elements();
+		get_elements();
+
+		mover->SetProperty(PropertyId::MarginLeft, Property(margin_left, Unit::PX));
+		mover->SetProperty(PropertyId::Height, Property(50.f + margin_left, Unit::PX));
+		context->Update();
+
+		check_points(get_elements());
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
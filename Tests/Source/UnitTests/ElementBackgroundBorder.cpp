@@ -71,6 +71,15 @@ TEST_CASE("ElementBackgroundBorder.render_stats")
 
 	TestsShell::RenderLoop();
 
+	// Rows outside the scroll container are culled, make sure they have all been rendered once before counting.
+	for (int i = 0; i < num_rows; i++)
+	{
+		wrapper->SetScrollTop(100.f * float(i));
+		TestsShell::RenderLoop();
+	}
+	wrapper->SetScrollTop(0.f);
+	TestsShell::RenderLoop();
+
 	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
 	if (!render_interface)
 		return;
@@ -178,9 +187,10 @@ TEST_CASE("ElementBackgroundBorder.background_edges_line_up_with_relative_offset
 
 	// When changing the position using fractional increments we expect the size of the backgrounds to change, resulting
 	// in new geometry. This is done to ensure that the top and bottom of each background lines up with the one for the
-	// next element, thereby avoiding any gaps.
-	CHECK(render_interface->GetCounters().compile_geometry > 0);
-	MESSAGE("Compile geometry after movement: ", render_interface->GetCounters().compile_geometry);
+	// next element, thereby avoiding any gaps. The new geometry may be submitted by updating previously merged geometry.
+	const auto& counters = render_interface->GetCounters();
+	CHECK(counters.compile_geometry + counters.update_geometry > 0);
+	MESSAGE("Compile geometry after movement: ", counters.compile_geometry, ", update geometry: ", counters.update_geometry);
 
 	document->Close();
 	TestsShell::ShutdownShell();
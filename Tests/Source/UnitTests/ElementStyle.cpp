@@ -1,4 +1,6 @@
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -56,3 +58,190 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_style_sharing_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { width: 500px; height: 500px; font-family: LatoLatin; }
+		div { display: block; height: 10px; width: 10px; }
+		.row { width: 20px; }
+		.row:hover { width: 30px; }
+		.row[selected] { width: 40px; }
+		.row:first-child { height: 11px; }
+		.marker + .row { height: 12px; }
+		.row:nth-child(5) { height: 13px; }
+		.big { font-size: 20px; width: 2em; }
+	</style>
+</head>
+<body>
+<div id="list"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.style_sharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_style_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+	list->SetInnerRML(R"(
+		<div class="row"/>
+		<div class="row"/>
+		<div class="row marker"/>
+		<div class="row"/>
+		<div class="row"/>
+		<div class="row" selected/>
+		<div class="row" style="width: 50px"/>
+		<div class="row"/>
+		<div class="row big"/>
+		<div class="row big"/>
+	)");
+	TestsShell::RenderLoop();
+
+	auto CheckSizes = [&](const Vector<Vector2f>& expected_sizes) {
+		REQUIRE(list->GetNumChildren() == (int)expected_sizes.size());
+		for (int i = 0; i < list->GetNumChildren(); i++)
+		{
+			const Vector2f size = list->GetChild(i)->GetBox().GetSize();
+			CHECK_MESSAGE(size == expected_sizes[i], "Row " << i);
+		}
+	};
+
+	// Siblings must only share their style when it is guaranteed to be equal, structural selectors, sibling combinators, attributes, local
+	// styles and pseudo classes all need to be considered.
+	CheckSizes({{20, 11}, {20, 10}, {20, 10}, {20, 12}, {20, 13}, {40, 10}, {50, 10}, {20, 10}, {40, 10}, {40, 10}});
+
+	list->GetChild(1)->SetPseudoClass("hover", true);
+	list->GetChild(5)->RemoveAttribute("selected");
+	list->GetChild(7)->SetAttribute("selected", "");
+	TestsShell::RenderLoop();
+	CheckSizes({{20, 11}, {30, 10}, {20, 10}, {20, 12}, {20, 13}, {20, 10}, {50, 10}, {40, 10}, {40, 10}, {40, 10}});
+
+	// Shared styles must be updated when the siblings change.
+	list->GetChild(1)->SetPseudoClass("hover", false);
+	list->GetChild(8)->SetClass("big", false);
+	list->RemoveChild(list->GetChild(0));
+	TestsShell::RenderLoop();
+	CheckSizes({{20, 11}, {20, 10}, {20, 12}, {20, 10}, {20, 13}, {50, 10}, {40, 10}, {20, 10}, {40, 10}});
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_parallel_styles_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { width: 100%; height: 100%; font-family: LatoLatin; font-size: 1vw; }
+		div { display: block; }
+		.panel { width: 20vw; font-size: 1.5em; }
+		.panel:nth-child(even) { font-size: 2vh; }
+		.row { height: 2em; width: 50%; }
+		.row + .row { width: 10vw; }
+		.row.selected { width: 15vw; transition: width 1s; }
+		.cell { width: 3vh; height: 1em; display: inline-block; }
+		.wide .cell { width: 5vh; }
+	</style>
+</head>
+<body/>
+</rml>
+)";
+
+TEST_CASE("elementstyle.parallel_styles")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	system_interface->SetManualTime(0);
+
+	// Run the same sequence of changes with and without worker threads, the resulting styles must be identical.
+	auto RunSequence = [&](int num_worker_threads) {
+		system_interface->SetNumWorkerThreads(num_worker_threads);
+		context->SetDimensions({1000, 800});
+
+		Vector<ElementDocument*> documents;
+		for (int i = 0; i < 3; i++)
+		{
+			ElementDocument* document = context->LoadDocumentFromMemory(document_parallel_styles_rml);
+			String rml;
+			for (int j = 0; j < 10; j++)
+			{
+				rml += "<div class='panel'>";
+				for (int k = 0; k < 10; k++)
+					rml += "<div class='row'><div class='cell'/><div class='cell'/>Text</div>";
+				rml += "</div>";
+			}
+			document->SetInnerRML(rml);
+			document->Show();
+			documents.push_back(document);
+		}
+		TestsShell::RenderLoop();
+
+		Vector<Vector<float>> results;
+		auto CollectResults = [&]() {
+			Vector<float> values;
+			for (ElementDocument* document : documents)
+			{
+				ElementList elements;
+				document->QuerySelectorAll(elements, "div");
+				for (Element* element : elements)
+				{
+					values.push_back(element->GetComputedValues().font_size());
+					values.push_back(element->GetBox().GetSize().x);
+					values.push_back(element->GetBox().GetSize().y);
+				}
+			}
+			results.push_back(std::move(values));
+		};
+		CollectResults();
+
+		context->SetDimensions({1200, 600});
+		TestsShell::RenderLoop();
+		CollectResults();
+
+		for (ElementDocument* document : documents)
+		{
+			document->GetChild(3)->GetChild(4)->SetClass("selected", true);
+			document->GetChild(5)->SetProperty(PropertyId::FontSize, Property(12.f, Unit::PX));
+		}
+		system_interface->SetManualTime(0.5);
+		TestsShell::RenderLoop();
+		CollectResults();
+
+		context->SetDimensions({800, 800});
+		system_interface->SetManualTime(2.0);
+		TestsShell::RenderLoop();
+		CollectResults();
+
+		for (ElementDocument* document : documents)
+			document->GetChild(7)->SetClass("wide", true);
+		TestsShell::RenderLoop();
+		CollectResults();
+
+		for (ElementDocument* document : documents)
+			document->Close();
+		context->Update();
+
+		system_interface->SetManualTime(0);
+		return results;
+	};
+
+	const Vector<Vector<float>> sequential_results = RunSequence(0);
+	const Vector<Vector<float>> parallel_results = RunSequence(4);
+
+	REQUIRE(sequential_results.size() == parallel_results.size());
+	for (size_t i = 0; i < sequential_results.size(); i++)
+		CHECK_MESSAGE(sequential_results[i] == parallel_results[i], "Step " << i);
+
+	system_interface->SetNumWorkerThreads(0);
+	TestsShell::ShutdownShell();
+}
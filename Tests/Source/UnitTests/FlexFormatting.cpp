@@ -175,3 +175,82 @@ TEST_CASE("FlexFormatting.dp_ratio")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_flex_nested_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 600px; height: 400px; }
+		.row { display: flex; flex-direction: row; }
+		.column { display: flex; flex-direction: column; }
+		.grow { flex: 1; }
+		.item { padding: 5px; border: 1px #000; }
+		.absolute { position: absolute; top: 0; right: 0; width: 20px; height: 20px; }
+		table { display: table; }
+		tr { display: table-row; }
+		td { display: table-cell; vertical-align: middle; }
+	</style>
+</head>
+<body>
+	<div class="row">
+		<div class="column grow">
+			<div class="row"><div class="item grow" id="text">Lorem ipsum</div><div class="item">dolor</div></div>
+			<div class="row"><div class="item">sit amet</div><div class="item grow"><div class="absolute"/>consectetur</div></div>
+		</div>
+		<div class="column">
+			<table><tr><td class="item">adipiscing</td><td class="item"><div class="row"><div class="item">elit</div></div></td></tr></table>
+			<div class="item" id="sized">sed do</div>
+		</div>
+	</div>
+</body>
+</rml>
+)";
+
+static void CheckEqualLayout(Element* element, Element* reference)
+{
+	CAPTURE(element->GetAddress());
+	CHECK(element->GetBox() == reference->GetBox());
+	CHECK(element->GetAbsoluteOffset() == reference->GetAbsoluteOffset());
+
+	REQUIRE(element->GetNumChildren() == reference->GetNumChildren());
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		CheckEqualLayout(element->GetChild(i), reference->GetChild(i));
+}
+
+TEST_CASE("FlexFormatting.Cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Flex and table items may reuse their previous formatting results, make sure that the layout always matches a freshly loaded document.
+	ElementDocument* document = context->LoadDocumentFromMemory(document_flex_nested_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	auto ApplyChanges = [](ElementDocument* target, int iteration) {
+		target->GetElementById("text")->SetInnerRML(iteration % 2 == 0 ? "Lorem ipsum dolor sit amet, consectetur adipiscing" : "Lorem");
+		target->GetElementById("sized")->SetProperty("width", iteration % 2 == 0 ? "150px" : "auto");
+	};
+
+	for (int iteration = 0; iteration < 4; iteration++)
+	{
+		CAPTURE(iteration);
+		ApplyChanges(document, iteration);
+		TestsShell::RenderLoop();
+
+		ElementDocument* reference_document = context->LoadDocumentFromMemory(document_flex_nested_rml);
+		REQUIRE(reference_document);
+		ApplyChanges(reference_document, iteration);
+		reference_document->Show();
+		TestsShell::RenderLoop();
+
+		CheckEqualLayout(document, reference_document);
+
+		reference_document->Close();
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
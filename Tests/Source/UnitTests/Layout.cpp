@@ -274,3 +274,77 @@ TEST_CASE("Layout.ScrollableOverflow.ChildMarginTriggersScrollbar")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("Layout.Boundary")
+{
+	const String document_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		scrollbarvertical { width: 15px; }
+		.boundary { width: 100px; height: 80px; overflow: auto; background: #3a3; }
+		.flex { display: flex; flex-wrap: wrap; }
+		.inline { display: inline-block; }
+		.positioned { position: relative; }
+		.item { width: 40px; height: 40px; background: #33a; }
+		.absolute { position: absolute; top: 10px; right: 10px; }
+	</style>
+</head>
+<body>
+	<div id="block" class="boundary"><div class="item"/></div>
+	<div id="flex" class="boundary flex"><div class="item"/></div>
+	<span>Text <div id="inline" class="boundary inline"><div class="item"/></div></span>
+	<div class="positioned"><div id="static" class="boundary"><div class="item absolute"/></div></div>
+	<div id="after" class="item"/>
+</body>
+</rml>
+)";
+
+	// Changes to the contents of layout boundaries are formatted independently of the rest of the document. Make sure that the result is
+	// identical to formatting the whole document, including the cases where we need to fall back to formatting the whole document.
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	const String new_items = R"(<div class="item"/><div class="item"/><div class="item"/><div class="item absolute"/>)";
+	const char* boundary_ids[] = {"block", "flex", "inline", "static"};
+	for (const char* id : boundary_ids)
+		document->GetElementById(id)->SetInnerRML(new_items);
+	TestsShell::RenderLoop();
+
+	ElementDocument* reference_document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(reference_document);
+	for (const char* id : boundary_ids)
+		reference_document->GetElementById(id)->SetInnerRML(new_items);
+	reference_document->Show();
+	TestsShell::RenderLoop();
+
+	for (const char* id : boundary_ids)
+	{
+		INFO("Boundary: " << String(id));
+		Element* element = document->GetElementById(id);
+		Element* reference = reference_document->GetElementById(id);
+		CHECK(element->GetClientWidth() == reference->GetClientWidth());
+		CHECK(element->GetScrollHeight() == reference->GetScrollHeight());
+		CHECK(element->GetBox() == reference->GetBox());
+
+		REQUIRE(element->GetNumChildren() == reference->GetNumChildren());
+		for (int i = 0; i < element->GetNumChildren(); i++)
+		{
+			INFO("Child: " << i);
+			CHECK(element->GetChild(i)->GetRelativeOffset() == reference->GetChild(i)->GetRelativeOffset());
+			CHECK(element->GetChild(i)->GetBox() == reference->GetChild(i)->GetBox());
+		}
+	}
+
+	CHECK(document->GetElementById("after")->GetRelativeOffset() == reference_document->GetElementById("after")->GetRelativeOffset());
+
+	document->Close();
+	reference_document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -3,8 +3,10 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StyleSheet.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
+#include <thread>
 
 using namespace Rml;
 
@@ -588,3 +590,239 @@ TEST_CASE("Selectors.placeholder")
 	context->UnloadDocument(document);
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("Selectors.dynamic_names")
+{
+	Context* context = TestsShell::GetContext();
+	const String document_rml = R"(
+<rml>
+<head>
+	<title>Demo</title>
+	<style>
+		body { width: 400px; height: 300px; font-family: LatoLatin; }
+		div { display: block; width: 10px; }
+		#late { width: 20px; }
+		.fresh { width: 30px; }
+		div:unseen { width: 40px; }
+	</style>
+</head>
+<body>
+	<div id="A"/>
+	<div id="B" class="first second"/>
+</body>
+</rml>
+)";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* a = document->GetElementById("A");
+	Element* b = document->GetElementById("B");
+
+	auto CheckSelector = [document](const String& selector, const String& expected_ids) {
+		ElementList elements;
+		document->QuerySelectorAll(elements, selector);
+		CHECK_MESSAGE(ElementListToIds(elements) == expected_ids, "Selector: ", selector);
+	};
+
+	CHECK(a->GetClientWidth() == 10.f);
+	CHECK(b->GetClassNames() == "first second");
+
+	// Names which have never been seen before by either the style sheet or any element.
+	CheckSelector(".never-used", "");
+	CheckSelector(":never-used", "");
+	CHECK_FALSE(a->IsClassSet("also-never-used"));
+	CHECK_FALSE(a->IsPseudoClassSet("also-never-used"));
+
+	a->SetClass("fresh", true);
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 30.f);
+	CheckSelector(".fresh", "A");
+
+	a->SetClass("fresh", false);
+	a->SetPseudoClass("unseen", true);
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 40.f);
+	CHECK(a->GetActivePseudoClasses() == StringList{"unseen"});
+	CheckSelector(".fresh", "");
+	CheckSelector(":unseen", "A");
+
+	a->SetPseudoClass("unseen", false);
+	a->SetId("late");
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 20.f);
+	CheckSelector("#late", "late");
+	CheckSelector("#A", "");
+
+	b->SetClass("second", false);
+	b->SetClass("third", true);
+	CHECK(b->GetClassNames() == "first third");
+	CheckSelector(".first.third", "B");
+	CheckSelector(".second", "");
+
+	context->UnloadDocument(document);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Selectors.ancestor_filter")
+{
+	Context* context = TestsShell::GetContext();
+	const String document_rml = R"(
+<rml>
+<head>
+	<title>Demo</title>
+	<style>
+		body { width: 400px; height: 300px; font-family: LatoLatin; }
+		div, span { display: block; }
+		.outer .inner span { width: 10px; }
+		#outer-id > div span { width: 20px; }
+		.sibling + .inner span { width: 30px; }
+	</style>
+</head>
+<body>
+	<div id="X" class="outer">
+		<div id="Y" class="inner"><span id="A"/></div>
+	</div>
+	<div id="Z">
+		<div id="S"/>
+		<div id="W"/>
+	</div>
+</body>
+</rml>
+)";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	Element* x = document->GetElementById("X");
+	Element* y = document->GetElementById("Y");
+	Element* a = document->GetElementById("A");
+	Element* w = document->GetElementById("W");
+
+	CHECK(a->GetClientWidth() == 10.f);
+
+	// Changing the names of an ancestor must be reflected in the style of its descendants.
+	x->SetClass("outer", false);
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 400.f);
+
+	x->SetId("outer-id");
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 20.f);
+
+	x->SetId("X");
+	x->SetClass("outer", true);
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 10.f);
+
+	// Moving the subtree to a new parent changes its ancestors.
+	ElementPtr y_ptr = x->RemoveChild(y);
+	w->AppendChild(std::move(y_ptr));
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 400.f);
+
+	w->SetClass("outer", true);
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 10.f);
+
+	// Names required of siblings are not required of ancestors.
+	w->SetClass("outer", false);
+	y_ptr = w->RemoveChild(y);
+	document->GetElementById("Z")->AppendChild(std::move(y_ptr));
+	document->GetElementById("W")->SetClass("sibling", true);
+	TestsShell::RenderLoop();
+	CHECK(a->GetClientWidth() == 30.f);
+
+	context->UnloadDocument(document);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Selectors.concurrent_definitions")
+{
+	Context* context = TestsShell::GetContext();
+	const String document_rml = R"(
+<rml>
+<head>
+	<title>Demo</title>
+	<style>
+		body { width: 400px; height: 300px; font-family: LatoLatin; }
+		div { display: block; }
+		.panel .row { height: 10px; }
+		.panel > .row:nth-child(odd) { height: 20px; }
+		.row .cell { width: 10px; }
+		.row.even .cell:first-child { width: 20px; }
+		#p2 .cell + .cell { width: 30px; }
+	</style>
+</head>
+<body/>
+</rml>
+)";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+
+	constexpr int num_panels = 8;
+	String inner_rml;
+	for (int i = 0; i < num_panels; i++)
+	{
+		inner_rml += CreateString("<div class=\"panel\" id=\"p%d\">", i);
+		for (int j = 0; j < 10; j++)
+			inner_rml += CreateString("<div class=\"row%s\"><div class=\"cell\"/><div class=\"cell\"/></div>", j % 2 ? "" : " even");
+		inner_rml += "</div>";
+	}
+	document->SetInnerRML(inner_rml);
+	document->Show();
+	TestsShell::RenderLoop();
+
+	const StyleSheet* style_sheet = document->GetStyleSheet();
+	REQUIRE(style_sheet);
+
+	auto CollectDescendants = [](Element* element, Vector<Element*>& out) {
+		auto Collect = [&out](Element* parent, auto& self) -> void {
+			for (int i = 0; i < parent->GetNumChildren(); i++)
+			{
+				out.push_back(parent->GetChild(i));
+				self(parent->GetChild(i), self);
+			}
+		};
+		Collect(element, Collect);
+	};
+
+	// Resolve the definitions of each panel subtree on its own thread, their common ancestors are already resolved.
+	Vector<Vector<Element*>> subtrees(num_panels);
+	Vector<Vector<SharedPtr<const ElementDefinition>>> concurrent_results(num_panels);
+	for (int i = 0; i < num_panels; i++)
+		CollectDescendants(document->GetChild(i), subtrees[i]);
+
+	Vector<std::thread> threads;
+	for (int i = 0; i < num_panels; i++)
+	{
+		threads.emplace_back([&, i]() {
+			for (int iteration = 0; iteration < 50; iteration++)
+			{
+				concurrent_results[i].clear();
+				for (Element* element : subtrees[i])
+					concurrent_results[i].push_back(style_sheet->GetElementDefinition(element));
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (int i = 0; i < num_panels; i++)
+	{
+		REQUIRE(concurrent_results[i].size() == subtrees[i].size());
+		for (size_t j = 0; j < subtrees[i].size(); j++)
+		{
+			const bool same_definition = (concurrent_results[i][j] == style_sheet->GetElementDefinition(subtrees[i][j]));
+			CHECK(same_definition);
+		}
+	}
+
+	context->UnloadDocument(document);
+	TestsShell::ShutdownShell();
+}